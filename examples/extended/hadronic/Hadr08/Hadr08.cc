@@ -0,0 +1,89 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+/// \file Hadr08.cc
+/// \brief Main program of the hadronic/Hadr08 example
+//
+// $Id$
+// 
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#include "G4RunManager.hh"
+#include "G4UIcommand.hh"
+#include "G4PhysListFactory.hh"
+#include "Randomize.hh"
+
+#include "DetectorConstruction.hh"
+#include "DeexcitationTest.hh"
+#include "CascadeTest.hh"
+#include "StringTableTest.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+int main(int argc,char** argv) {
+
+  // name of the test and number of calls per test case
+  G4String testName = (argc > 1) ? argv[1] : "deexcitation";
+  G4int nCalls = (argc > 2) ? G4UIcommand::ConvertToInt(argv[2]) : 10000;
+
+  //choose the Random engine
+  G4Random::setTheEngine(new CLHEP::RanecuEngine);
+
+  // the models are used without tracking, the run manager is only
+  // needed to construct particles and to initialise the physics list
+  G4RunManager* runManager = new G4RunManager;
+  runManager->SetUserInitialization(new DetectorConstruction);
+
+  // physics list is defined by PHYSLIST environment variable, 
+  // FTFP_BERT by default
+  G4PhysListFactory factory;
+  runManager->SetUserInitialization(factory.ReferencePhysList());
+  runManager->Initialize();
+
+  G4int status = 0;
+  if(testName == "deexcitation") {
+    DeexcitationTest test(nCalls);
+    status = test.Run();
+  } else if(testName == "cascade") {
+    CascadeTest test(nCalls);
+    status = test.Run();
+  } else if(testName == "stringtable") {
+    StringTableTest test(nCalls);
+    status = test.Run();
+  } else {
+    G4cout << "Unknown test " << testName << "\n"
+           << "Usage: Hadr08 [deexcitation|cascade|stringtable]"
+           << " [number of calls]" << G4endl;
+    status = 1;
+  }
+
+  //job termination
+  //
+  delete runManager;
+
+  return (0 == status) ? 0 : 1;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,73 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+/// \file CascadeTest.hh
+/// \brief Definition of the CascadeTest class
+//
+// $Id$
+//
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#ifndef CascadeTest_h
+#define CascadeTest_h 1
+
+#include "globals.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+/// Timing of the Bertini cascade (G4CascadeInterface).
+/// First the channel selection of several G4CascadeChannel tables is
+/// sampled with the same random numbers by searching the running sums
+/// of the cross sections (G4CascadeSampler::sampleMultiplicity and
+/// sampleFinalStateIndex, used by the cascade) and by summing the
+/// interpolated cross sections (findMultiplicity and findFinalStateIndex).
+/// Both must select the same multiplicity and channel; the time per
+/// selection is printed. Then full interactions of hadrons with light,
+/// medium and heavy nuclei are timed.
+
+class CascadeTest
+{
+  public:
+
+    CascadeTest(G4int nCalls);
+   ~CascadeTest();
+
+    // returns the number of channel selections that differ between
+    // both sampling methods
+    G4int Run();
+
+  private:
+
+    G4int TestSampling();
+    void  TestInteractions();
+
+    G4int fNCalls;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,83 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+/// \file DeexcitationTest.hh
+/// \brief Definition of the DeexcitationTest class
+//
+// $Id$
+// 
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#ifndef DeexcitationTest_h
+#define DeexcitationTest_h 1
+
+#include "globals.hh"
+#include <vector>
+
+class G4ExcitationHandler;
+class G4Fragment;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+/// Excited nuclei are de-excited by two instances of G4ExcitationHandler,
+/// one computing the evaporation probabilities by numerical integration
+/// and one interpolating them from tables (G4DeexPrecoParameters::
+/// SetUseEvaporationTables). The CPU time per call and the mean 
+/// multiplicity and kinetic energy of the emitted particles are compared.
+
+class DeexcitationTest
+{
+  public:
+  
+    DeexcitationTest(G4int nCalls);
+   ~DeexcitationTest();
+
+    // returns the number of observables differing by more than
+    // the limit (in standard deviations) between both computations
+    G4int Run(G4double limit = 4.0);
+
+  private:
+
+    // sums over calls of the multiplicity and the kinetic energy 
+    // of each particle type, and of their squares
+    struct Result {
+      G4double time;
+      std::vector<G4double> sum;
+      std::vector<G4double> sum2;
+    };
+
+    void Sample(G4ExcitationHandler*, const G4Fragment&, Result&);
+
+    G4int Compare(const Result&, const Result&, G4double limit);
+
+    G4int fNCalls;
+    std::vector<G4String> fNames;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
+
@@ -0,0 +1,75 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+/// \file StringTableTest.hh
+/// \brief Definition of the StringTableTest class
+//
+// $Id$
+//
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#ifndef StringTableTest_h
+#define StringTableTest_h 1
+
+#include "globals.hh"
+#include <vector>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+/// Lookup of particle definitions by PDG code, as done by the string 
+/// models for partons and hadrons. The same random sequence of codes
+/// (quarks, diquarks, mesons, baryons, their anti-particles and two 
+/// codes outside the flat array) is looked up in G4ParticleTable and
+/// in G4StringParticleTable. Both must return the same, non-null, 
+/// definition; the time per lookup is printed. Then full interactions
+/// of G4TheoFSGenerator with the FTF and QGS string models and Lund or
+/// QGSM string fragmentation are timed for fixed projectiles, energies
+/// and target nuclei.
+
+class StringTableTest
+{
+  public:
+
+    StringTableTest(G4int nCalls);
+   ~StringTableTest();
+
+    // returns the number of lookups returning different or null
+    // definitions, plus the number of interactions without secondaries
+    G4int Run();
+
+  private:
+
+    G4int TestLookup();
+    G4int TestInteractions();
+
+    G4int fNCalls;
+    std::vector<G4int> fCodes;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#endif
@@ -0,0 +1,231 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+/// \file CascadeTest.cc
+/// \brief Implementation of the CascadeTest class
+//
+// $Id$
+//
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#include "CascadeTest.hh"
+
+#include "G4CascadeInterface.hh"
+#include "G4CascadePPChannel.hh"
+#include "G4CascadeNPChannel.hh"
+#include "G4CascadePiPlusPChannel.hh"
+#include "G4CascadePiMinusPChannel.hh"
+#include "G4CascadeKminusPChannel.hh"
+#include "G4CascadeLambdaPChannel.hh"
+#include "G4HadProjectile.hh"
+#include "G4HadFinalState.hh"
+#include "G4Nucleus.hh"
+#include "G4DynamicParticle.hh"
+#include "G4ParticleTable.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Log.hh"
+#include "G4Exp.hh"
+#include "Randomize.hh"
+#include <iomanip>
+#include <chrono>
+#include <vector>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+namespace
+{
+  // interactions: projectile, kinetic energy in MeV, target Z and A
+  const G4int    nCases = 5;
+  const char*    caseParticle[nCases] =
+    { "proton", "proton", "proton", "pi-", "neutron" };
+  const G4double caseEnergy[nCases] = { 1000., 1000., 1000., 5000., 100. };
+  const G4int    caseZ[nCases] = { 6, 29, 82, 29, 82 };
+  const G4int    caseA[nCases] = { 12, 63, 208, 63, 208 };
+
+  // kinetic energies of the channel selection, in GeV as in the cascade,
+  // are sampled uniformly in log between these limits
+  const G4double ekinMin = 0.001;
+  const G4double ekinMax = 30.;
+
+  // Selects a multiplicity and a channel for each energy, once with
+  // each method of G4CascadeSampler, starting from the same seed.
+  // Returns the number of calls for which the selections differ.
+  template <class CHANNEL, class DATA>
+  G4int CompareChannel(const G4String& name,
+                       const std::vector<G4double>& ekin)
+  {
+    CHANNEL channel;
+    size_t n = ekin.size();
+    std::vector<G4int> mult0(n), mult1(n), chan0(n), chan1(n);
+
+    G4Random::setTheSeed(12345);
+    std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+    for(size_t i=0; i<n; ++i) {
+      mult0[i] = channel.findMultiplicity(ekin[i], DATA::data.multiplicities);
+      chan0[i] = channel.findFinalStateIndex(mult0[i], ekin[i],
+                                             DATA::data.index,
+                                             DATA::data.crossSections);
+    }
+    G4double time0 = std::chrono::duration<G4double>
+      (std::chrono::steady_clock::now() - start).count();
+
+    G4Random::setTheSeed(12345);
+    start = std::chrono::steady_clock::now();
+    for(size_t i=0; i<n; ++i) {
+      mult1[i] = channel.sampleMultiplicity(ekin[i],
+                                            DATA::data.cumMultiplicities);
+      chan1[i] = channel.sampleFinalStateIndex(mult1[i], ekin[i],
+                                               DATA::data.index,
+                                               DATA::data.cumulative);
+    }
+    G4double time1 = std::chrono::duration<G4double>
+      (std::chrono::steady_clock::now() - start).count();
+
+    G4int nDiff = 0;
+    for(size_t i=0; i<n; ++i) {
+      // findFinalStateIndex returns the absolute index if the
+      // multiplicity has a single channel, the relative one otherwise
+      G4int m = mult0[i];
+      G4int c0 = (DATA::data.index[m-1] - DATA::data.index[m-2] <= 1)
+        ? chan0[i] - DATA::data.index[m-2] : chan0[i];
+      if(m != mult1[i] || c0 != chan1[i]) { ++nDiff; }
+    }
+    G4cout << std::setw(14) << name << std::setprecision(4)
+           << std::setw(14) << time0*1.e+9/n << std::setw(14) << time1*1.e+9/n
+           << std::setw(10) << ((time1 > 0.0) ? time0/time1 : 0.0)
+           << std::setw(12) << nDiff << (nDiff > 0 ? "  <---" : "") << G4endl;
+    return nDiff;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+CascadeTest::CascadeTest(G4int nCalls)
+:fNCalls(std::max(nCalls, 1))
+{}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+CascadeTest::~CascadeTest()
+{}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int CascadeTest::Run()
+{
+  G4int nDiff = TestSampling();
+  TestInteractions();
+  G4cout << "\n=== " << nDiff << " channel selections differ between the"
+         << " two sampling methods" << G4endl;
+  return nDiff;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int CascadeTest::TestSampling()
+{
+  // selections are cheap, more of them are needed for the timing
+  size_t n = 100*fNCalls;
+  std::vector<G4double> ekin(n);
+  G4double x0 = G4Log(ekinMin);
+  G4double dx = G4Log(ekinMax) - x0;
+  for(size_t i=0; i<n; ++i) { ekin[i] = G4Exp(x0 + dx*G4UniformRand()); }
+
+  G4cout << "\n=== Bertini channel selection: sum of interpolated cross"
+         << " sections versus running sums, " << n << " selections"
+         << " per table, E(GeV) from " << ekinMin << " to " << ekinMax
+         << G4endl;
+  G4cout << std::setw(14) << "table"
+         << std::setw(14) << "sum (ns)" << std::setw(14) << "running (ns)"
+         << std::setw(10) << "speedup" << std::setw(12) << "differ"
+         << G4endl;
+
+  G4int nDiff = 0;
+  nDiff += CompareChannel<G4CascadePPChannel,
+                          G4CascadePPChannelData>("p p", ekin);
+  nDiff += CompareChannel<G4CascadeNPChannel,
+                          G4CascadeNPChannelData>("n p", ekin);
+  nDiff += CompareChannel<G4CascadePiPlusPChannel,
+                          G4CascadePiPlusPChannelData>("pi+ p", ekin);
+  nDiff += CompareChannel<G4CascadePiMinusPChannel,
+                          G4CascadePiMinusPChannelData>("pi- p", ekin);
+  nDiff += CompareChannel<G4CascadeKminusPChannel,
+                          G4CascadeKminusPChannelData>("K- p", ekin);
+  nDiff += CompareChannel<G4CascadeLambdaPChannel,
+                          G4CascadeLambdaPChannelData>("lambda p", ekin);
+  return nDiff;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void CascadeTest::TestInteractions()
+{
+  G4CascadeInterface* bertini = new G4CascadeInterface();
+  G4ParticleTable* table = G4ParticleTable::GetParticleTable();
+
+  G4cout << "\n=== Bertini cascade: " << fNCalls
+         << " interactions per case" << G4endl;
+  G4cout << std::setw(10) << "particle" << std::setw(10) << "E(MeV)"
+         << std::setw(6) << "Z" << std::setw(6) << "A"
+         << std::setw(14) << "time (mus)" << std::setw(14) << "secondaries"
+         << G4endl;
+
+  G4Random::setTheSeed(12345);
+  for(G4int i=0; i<nCases; ++i) {
+    G4DynamicParticle dp(table->FindParticle(caseParticle[i]),
+                         G4ThreeVector(0., 0., 1.), caseEnergy[i]*MeV);
+    G4HadProjectile projectile(dp);
+    G4Nucleus target(caseA[i], caseZ[i]);
+
+    G4double nSec = 0.0;
+    std::chrono::steady_clock::duration time(0);
+    for(G4int n=0; n<fNCalls; ++n) {
+      std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+      G4HadFinalState* result = bertini->ApplyYourself(projectile, target);
+      time += std::chrono::steady_clock::now() - start;
+
+      // the secondaries are owned by the caller
+      G4int nsec = result->GetNumberOfSecondaries();
+      nSec += nsec;
+      for(G4int j=0; j<nsec; ++j) {
+        delete result->GetSecondary(j)->GetParticle();
+      }
+      result->Clear();
+    }
+    G4cout << std::setw(10) << caseParticle[i]
+           << std::setw(10) << caseEnergy[i]
+           << std::setw(6) << caseZ[i] << std::setw(6) << caseA[i]
+           << std::setprecision(4) << std::setw(14)
+           << std::chrono::duration<G4double>(time).count()*1.e+6/fNCalls
+           << std::setw(14) << nSec/fNCalls << G4endl;
+  }
+  delete bertini;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -0,0 +1,212 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+/// \file DeexcitationTest.cc
+/// \brief Implementation of the DeexcitationTest class
+//
+// $Id$
+//
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#include "DeexcitationTest.hh"
+
+#include "G4ExcitationHandler.hh"
+#include "G4Fragment.hh"
+#include "G4ReactionProductVector.hh"
+#include "G4ReactionProduct.hh"
+#include "G4NucleiProperties.hh"
+#include "G4NuclearLevelData.hh"
+#include "G4DeexPrecoParameters.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4SystemOfUnits.hh"
+#include "Randomize.hh"
+#include <iomanip>
+#include <chrono>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+namespace
+{
+  // excited nuclei: Z, A, excitation energy in MeV
+  const G4int    nCases = 5;
+  const G4int    caseZ[nCases]  = { 13, 26, 26, 50, 82 };
+  const G4int    caseA[nCases]  = { 27, 56, 56, 120, 208 };
+  const G4double caseEx[nCases] = { 40., 20., 80., 60., 100. };
+
+  const G4int nTypes = 7;
+  const char* typeName[nTypes] = 
+    { "neutron", "proton", "deuteron", "triton", "He3", "alpha", "gamma" };
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+DeexcitationTest::DeexcitationTest(G4int nCalls)
+:fNCalls(std::max(nCalls, 2))
+{
+  for(G4int i=0; i<nTypes; ++i) {
+    fNames.push_back(G4String("N(") + typeName[i] + ")");
+  }
+  for(G4int i=0; i<nTypes; ++i) {
+    fNames.push_back(G4String("Ekin(") + typeName[i] + ")");
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+DeexcitationTest::~DeexcitationTest()
+{}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int DeexcitationTest::Run(G4double limit)
+{
+  G4DeexPrecoParameters* param = 
+    G4NuclearLevelData::GetInstance()->GetParameters();
+  G4bool useTables = param->UseEvaporationTables();
+
+  // the option is read by the evaporation channels at initialisation
+  param->SetUseEvaporationTables(false);
+  G4ExcitationHandler* standard = new G4ExcitationHandler();
+  standard->Initialise();
+  param->SetUseEvaporationTables(true);
+  G4ExcitationHandler* tabulated = new G4ExcitationHandler();
+  tabulated->Initialise();
+  param->SetUseEvaporationTables(useTables);
+
+  G4cout << "\n=== De-excitation: numerical integration versus tables of"
+         << " evaporation probabilities, " << fNCalls << " calls per nucleus"
+         << G4endl;
+  if(0 >= param->GetDeexModelType()) {
+    G4cout << "    Tables are not used with OPTxs= " 
+           << param->GetDeexModelType() << G4endl;
+  }
+
+  G4int nFailed = 0;
+  for(G4int i=0; i<nCases; ++i) {
+    G4int Z = caseZ[i];
+    G4int A = caseA[i];
+    G4double ex = caseEx[i]*MeV;
+    G4double mass = G4NucleiProperties::GetNuclearMass(A, Z) + ex;
+    G4Fragment fragment(A, Z, G4LorentzVector(0., 0., 0., mass));
+
+    // tables are built on first use, this is not included in the timing
+    Result res0, res1;
+    Sample(tabulated, fragment, res1);
+
+    G4Random::setTheSeed(12345);
+    Sample(standard, fragment, res0);
+    G4Random::setTheSeed(12345);
+    Sample(tabulated, fragment, res1);
+
+    G4cout << "\n--- Z= " << Z << " A= " << A << " Ex(MeV)= " << ex/MeV
+           << "   time per call (microsec): " 
+           << std::setprecision(4) << res0.time*1.e+6/fNCalls << " (integral) "
+           << res1.time*1.e+6/fNCalls << " (tables), speedup " 
+           << ((res1.time > 0.0) ? res0.time/res1.time : 0.0) << G4endl;
+    nFailed += Compare(res0, res1, limit);
+  }
+  G4cout << "\n=== " << nFailed << " observables differ by more than "
+         << limit << " standard deviations" << G4endl;
+
+  delete standard;
+  delete tabulated;
+  return nFailed;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void DeexcitationTest::Sample(G4ExcitationHandler* handler, 
+                              const G4Fragment& fragment, Result& res)
+{
+  G4int nObs = 2*nTypes;
+  res.sum.assign(nObs, 0.0);
+  res.sum2.assign(nObs, 0.0);
+  std::vector<G4double> x(nObs, 0.0);
+
+  // only the calls are timed, a clock with fine resolution is needed
+  std::chrono::steady_clock::duration time(0);
+  for(G4int n=0; n<fNCalls; ++n) {
+    std::chrono::steady_clock::time_point start = 
+      std::chrono::steady_clock::now();
+    G4ReactionProductVector* products = handler->BreakItUp(fragment);
+    time += std::chrono::steady_clock::now() - start;
+
+    x.assign(nObs, 0.0);
+    for(size_t j=0; j<products->size(); ++j) {
+      G4ReactionProduct* p = (*products)[j];
+      const G4ParticleDefinition* part = p->GetDefinition();
+      G4int type = -1;
+      if(part->GetParticleName() == "gamma") { type = 6; }
+      else {
+        for(G4int k=0; k<nTypes-1; ++k) {
+          if(part->GetParticleName() == typeName[k]) { type = k; break; }
+        }
+      }
+      if(0 <= type) {
+        x[type] += 1.0;
+        x[nTypes + type] += p->GetKineticEnergy()/MeV;
+      }
+      delete p;
+    }
+    delete products;
+    for(G4int k=0; k<nObs; ++k) {
+      res.sum[k] += x[k];
+      res.sum2[k] += x[k]*x[k];
+    }
+  }
+  res.time = std::chrono::duration<G4double>(time).count();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int DeexcitationTest::Compare(const Result& res0, const Result& res1, 
+                                G4double limit)
+{
+  G4int nFailed = 0;
+  G4double norm = 1.0/fNCalls;
+  G4cout << std::setw(18) << "observable" 
+         << std::setw(14) << "integral" << std::setw(12) << "error"
+         << std::setw(14) << "tables" << std::setw(12) << "error"
+         << std::setw(10) << "diff/err" << G4endl;
+  for(size_t k=0; k<fNames.size(); ++k) {
+    G4double m0 = res0.sum[k]*norm;
+    G4double m1 = res1.sum[k]*norm;
+    G4double e0 = std::sqrt(std::max(res0.sum2[k]*norm - m0*m0, 0.0)*norm);
+    G4double e1 = std::sqrt(std::max(res1.sum2[k]*norm - m1*m1, 0.0)*norm);
+    G4double err = std::sqrt(e0*e0 + e1*e1);
+    G4double dev = (err > 0.0) ? (m1 - m0)/err : 0.0;
+    G4bool failed = (std::abs(dev) > limit);
+    if(failed) { ++nFailed; }
+    G4cout << std::setw(18) << fNames[k] << std::setprecision(5)
+           << std::setw(14) << m0 << std::setw(12) << e0
+           << std::setw(14) << m1 << std::setw(12) << e1
+           << std::setprecision(3) << std::setw(10) << dev
+           << (failed ? "  <---" : "") << G4endl;
+  }
+  return nFailed;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
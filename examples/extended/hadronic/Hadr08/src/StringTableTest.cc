@@ -0,0 +1,252 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+/// \file StringTableTest.cc
+/// \brief Implementation of the StringTableTest class
+//
+// $Id$
+//
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+#include "StringTableTest.hh"
+
+#include "G4StringParticleTable.hh"
+#include "G4ParticleTable.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4TheoFSGenerator.hh"
+#include "G4FTFModel.hh"
+#include "G4QGSModel.hh"
+#include "G4QGSParticipants.hh"
+#include "G4ExcitedStringDecay.hh"
+#include "G4LundStringFragmentation.hh"
+#include "G4QGSMFragmentation.hh"
+#include "G4GeneratorPrecompoundInterface.hh"
+#include "G4HadProjectile.hh"
+#include "G4HadFinalState.hh"
+#include "G4Nucleus.hh"
+#include "G4DynamicParticle.hh"
+#include "G4SystemOfUnits.hh"
+#include "Randomize.hh"
+#include <iomanip>
+#include <chrono>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+namespace
+{
+  // PDG codes looked up by the string models: quarks, diquarks, mesons
+  // and baryons of the flat array, and two codes passed on to
+  // G4ParticleTable (f0(980) and pi(1300)+)
+  const G4int nCodes = 40;
+  const G4int codes[nCodes] = 
+    { 1, 2, 3, 4,
+      1103, 2101, 2103, 2203, 3101, 3103, 3201, 3203, 3303,
+      111, 211, 221, 331, 113, 213, 223, 333, 311, 321, 313, 323, 411, 421,
+      2212, 2112, 3122, 3222, 3212, 3112, 3322, 3312, 2224, 2214, 4122,
+      9010221, 100211 };
+
+  // interactions: projectile, kinetic energy in GeV, target Z and A
+  const G4int    nCases = 4;
+  const char*    caseParticle[nCases] = 
+    { "proton", "proton", "pi-", "neutron" };
+  const G4double caseEnergy[nCases] = { 20., 100., 50., 30. };
+  const G4int    caseZ[nCases] = { 6, 29, 82, 29 };
+  const G4int    caseA[nCases] = { 12, 63, 208, 63 };
+
+  // string model and fragmentation of G4TheoFSGenerator
+  enum { FTFLund = 0, QGSLund, QGSQGSM, nGenerators };
+  const char* generatorName[nGenerators] = 
+    { "FTF+Lund", "QGS+Lund", "QGS+QGSM" };
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+StringTableTest::StringTableTest(G4int nCalls)
+:fNCalls(std::max(nCalls, 1))
+{
+  // known particles and their anti-particles are requested
+  G4ParticleTable* particleTable = G4ParticleTable::GetParticleTable();
+  std::vector<G4int> known;
+  for(G4int i=0; i<nCodes; ++i) {
+    if(particleTable->FindParticle(codes[i]))  { known.push_back(codes[i]); }
+    if(particleTable->FindParticle(-codes[i])) { known.push_back(-codes[i]); }
+  }
+
+  // lookups are cheap, more of them are needed for the timing
+  size_t n = 100*fNCalls;
+  G4int nKnown = known.size();
+  fCodes.resize(n);
+  for(size_t i=0; i<n; ++i) {
+    fCodes[i] = known[G4int(nKnown*G4UniformRand())%nKnown];
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+StringTableTest::~StringTableTest()
+{}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int StringTableTest::Run()
+{
+  G4int nDiff = TestLookup();
+  return nDiff + TestInteractions();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int StringTableTest::TestLookup()
+{
+  G4ParticleTable* particleTable = G4ParticleTable::GetParticleTable();
+  G4StringParticleTable* stringTable = G4StringParticleTable::GetInstance();
+  size_t n = fCodes.size();
+  std::vector<G4ParticleDefinition*> part0(n), part1(n);
+
+  // the array is filled on first use, this is not included in the timing
+  for(size_t i=0; i<n; ++i) { stringTable->FindParticle(fCodes[i]); }
+
+  std::chrono::steady_clock::time_point start = 
+    std::chrono::steady_clock::now();
+  for(size_t i=0; i<n; ++i) {
+    part0[i] = particleTable->FindParticle(fCodes[i]);
+  }
+  G4double time0 = std::chrono::duration<G4double>
+    (std::chrono::steady_clock::now() - start).count();
+
+  start = std::chrono::steady_clock::now();
+  for(size_t i=0; i<n; ++i) {
+    part1[i] = stringTable->FindParticle(fCodes[i]);
+  }
+  G4double time1 = std::chrono::duration<G4double>
+    (std::chrono::steady_clock::now() - start).count();
+
+  G4int nDiff = 0;
+  for(size_t i=0; i<n; ++i) {
+    if(part0[i] != part1[i] || !part1[i]) { ++nDiff; }
+  }
+
+  G4cout << "\n=== String models: lookup of particle definitions by PDG"
+         << " code, " << n << " lookups" << G4endl;
+  G4cout << "    time per lookup (ns): " << std::setprecision(4)
+         << time0*1.e+9/n << " (G4ParticleTable) " 
+         << time1*1.e+9/n << " (G4StringParticleTable), speedup "
+         << ((time1 > 0.0) ? time0/time1 : 0.0) << G4endl;
+  G4cout << "\n=== " << nDiff << " lookups return different or null"
+         << " definitions"
+         << G4endl;
+  return nDiff;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4int StringTableTest::TestInteractions()
+{
+  // string models are slow, fewer interactions are timed
+  G4int nInter = std::max(fNCalls/10, 1);
+  G4ParticleTable* table = G4ParticleTable::GetParticleTable();
+
+  G4cout << "\n=== G4TheoFSGenerator: " << nInter
+         << " interactions per case" << G4endl;
+  G4cout << std::setw(10) << "model" << std::setw(10) << "particle" 
+         << std::setw(10) << "E(GeV)"
+         << std::setw(6) << "Z" << std::setw(6) << "A"
+         << std::setw(14) << "time (ms)" << std::setw(14) << "secondaries"
+         << G4endl;
+
+  // the string model owns neither the string decay nor the
+  // fragmentation, the generator owns none of its components;
+  // G4VLongitudinalStringDecay::FragmentationMass keeps the hadron
+  // builder of the first fragmentation used in the thread, so all
+  // of them are deleted at the end only
+  G4VLongitudinalStringDecay* fragmentation[nGenerators];
+  G4ExcitedStringDecay* stringDecay[nGenerators];
+  G4VPartonStringModel* stringModel[nGenerators];
+  G4GeneratorPrecompoundInterface* transport[nGenerators];
+  G4TheoFSGenerator* generator[nGenerators];
+  for(G4int k=0; k<nGenerators; ++k) {
+    if(QGSQGSM == k) { fragmentation[k] = new G4QGSMFragmentation(); }
+    else             { fragmentation[k] = new G4LundStringFragmentation(); }
+    stringDecay[k] = new G4ExcitedStringDecay(fragmentation[k]);
+    if(FTFLund == k) { stringModel[k] = new G4FTFModel(); }
+    else { stringModel[k] = new G4QGSModel<G4QGSParticipants>(); }
+    stringModel[k]->SetFragmentationModel(stringDecay[k]);
+    transport[k] = new G4GeneratorPrecompoundInterface();
+    generator[k] = new G4TheoFSGenerator(generatorName[k]);
+    generator[k]->SetHighEnergyGenerator(stringModel[k]);
+    generator[k]->SetTransport(transport[k]);
+  }
+
+  G4int nEmpty = 0;
+  for(G4int k=0; k<nGenerators; ++k) {
+    G4Random::setTheSeed(12345);
+    for(G4int i=0; i<nCases; ++i) {
+      G4DynamicParticle dp(table->FindParticle(caseParticle[i]),
+                           G4ThreeVector(0., 0., 1.), caseEnergy[i]*GeV);
+      G4HadProjectile projectile(dp);
+      G4Nucleus target(caseA[i], caseZ[i]);
+
+      G4double nSec = 0.0;
+      std::chrono::steady_clock::duration time(0);
+      for(G4int n=0; n<nInter; ++n) {
+        std::chrono::steady_clock::time_point start =
+          std::chrono::steady_clock::now();
+        G4HadFinalState* result = 
+          generator[k]->ApplyYourself(projectile, target);
+        time += std::chrono::steady_clock::now() - start;
+
+        // the secondaries are owned by the caller
+        G4int nsec = result->GetNumberOfSecondaries();
+        if(0 == nsec) { ++nEmpty; }
+        nSec += nsec;
+        for(G4int j=0; j<nsec; ++j) {
+          delete result->GetSecondary(j)->GetParticle();
+        }
+        result->Clear();
+      }
+      G4cout << std::setw(10) << generatorName[k] 
+             << std::setw(10) << caseParticle[i]
+             << std::setw(10) << caseEnergy[i]
+             << std::setw(6) << caseZ[i] << std::setw(6) << caseA[i]
+             << std::setprecision(4) << std::setw(14)
+             << std::chrono::duration<G4double>(time).count()*1.e+3/nInter
+             << std::setw(14) << nSec/nInter << G4endl;
+    }
+  }
+  for(G4int k=0; k<nGenerators; ++k) {
+    delete generator[k];
+    delete transport[k];
+    delete stringModel[k];
+    delete stringDecay[k];
+    delete fragmentation[k];
+  }
+  G4cout << "\n=== " << nEmpty << " interactions without secondaries"
+         << G4endl;
+  return nEmpty;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
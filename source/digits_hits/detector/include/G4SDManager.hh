@@ -74,7 +74,9 @@ class G4SDManager
 
   public:
       G4VSensitiveDetector* FindSensitiveDetector(G4String dName, G4bool warning = true);
-      G4HCofThisEvent* PrepareNewEvent();
+      G4HCofThisEvent* PrepareNewEvent(G4HCofThisEvent* recycledHCE = 0);
+      //  If recycledHCE is given (event recycling mode of G4RunManager), it is
+      // cleared and reused instead of creating a new G4HCofThisEvent.
       void TerminateCurrentEvent(G4HCofThisEvent* HCE);
       void AddNewCollection(G4String SDname,G4String DCname);
 
@@ -96,6 +96,17 @@ class G4VSensitiveDetector
       //  This is a utility method which returns the hits collection ID of the
       // "i"-th collection. "i" is the order (starting with zero) of the collection
       // whose name is stored to the collectionName protected vector.
+      template <class T> inline T* GetRecycledCollection(G4HCofThisEvent* HCE,
+                                                         G4int HCID) const
+      {
+        if(HCID<0 || HCID>=HCE->GetCapacity()) return 0;
+        return dynamic_cast<T*>(HCE->GetHC(HCID));
+      }
+      //  When events are recycled (see G4RunManager::SetEventRecycling()), the
+      // hits collections of the previous event are emptied and left in the
+      // G4HCofThisEvent object. Initialize() may then reuse the collection
+      // returned by this method, with its capacity, instead of creating and
+      // adding a new one. Null is returned for a fresh G4HCofThisEvent.
       G4CollectionNameVector collectionName;
       //  This protected name vector must be filled at the constructor of the user's
       // concrete class for registering the name(s) of hits collection(s) being
@@ -106,9 +106,16 @@ void G4SDManager::AddNewCollection(G4String SDname,G4String DCname)
   }
 }
 
-G4HCofThisEvent* G4SDManager::PrepareNewEvent()
+G4HCofThisEvent* G4SDManager::PrepareNewEvent(G4HCofThisEvent* recycledHCE)
 {
-  G4HCofThisEvent* HCE = new G4HCofThisEvent(HCtable->entries());
+  G4HCofThisEvent* HCE = recycledHCE;
+  if(HCE && HCE->GetCapacity()==HCtable->entries())
+  { HCE->ClearForReuse(); }
+  else
+  {
+    delete HCE;
+    HCE = new G4HCofThisEvent(HCtable->entries());
+  }
   treeTop->Initialize(HCE);
   return HCE;
 }
@@ -56,6 +56,11 @@ class G4HCofThisEvent
       inline void operator delete(void* anHCoTE);
 
       void AddHitsCollection(G4int HCID,G4VHitsCollection * aHC);
+      void ClearForReuse();
+      //  Used by G4SDManager when the object is recycled for the next event:
+      // collections supporting G4VHitsCollection::ClearForReuse() are emptied
+      // and kept, the others are deleted. A collection replaced by
+      // AddHitsCollection() is deleted.
 
       G4HCofThisEvent(const G4HCofThisEvent&);
       G4HCofThisEvent& operator=(const G4HCofThisEvent&);
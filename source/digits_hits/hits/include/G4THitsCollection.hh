@@ -122,6 +122,14 @@ template <class T> class G4THitsCollection : public G4HitsCollection
       {
           if (!anHCAllocator_G4MT_TLS_) anHCAllocator_G4MT_TLS_ = new G4Allocator<G4HitsCollection>;
           return ((std::vector<T*>*)theCollection)->size(); }
+      virtual G4bool ClearForReuse()
+      {
+          std::vector<T*>*theHitsCollection = (std::vector<T*>*)theCollection;
+        for(size_t i=0;i<theHitsCollection->size();i++)
+        { delete (*theHitsCollection)[i]; }
+        theHitsCollection->clear();
+        return true;
+      }
 
 };
 
@@ -207,6 +207,8 @@ template <typename T> class G4THitsMap : public G4HitsCollection
     virtual G4VHit* GetHit(size_t) const {return 0;}
     virtual size_t GetSize() const
     { return ((std::map<G4int,T*>*)theCollection)->size(); }
+    virtual G4bool ClearForReuse()
+    { clear(); return true; }
 
 };
 
@@ -78,6 +78,11 @@ class G4VHitsCollection
       virtual G4VHit* GetHit(size_t) const { return nullptr; } 
       virtual size_t GetSize() const { return 0; };
 
+      // Deletes the hits and keeps the collection (and its storage) for
+      // the next event. Returns false if the collection does not support
+      // it, in which case the collection itself must be deleted.
+      virtual G4bool ClearForReuse() { return false; }
+
 };
 
 #endif
@@ -59,10 +59,24 @@ void G4HCofThisEvent::AddHitsCollection(G4int HCID,G4VHitsCollection * aHC)
   if(HCID>=0 && HCID<G4int(HC->size()))
   {
     aHC->SetColID(HCID);
+    if((*HC)[HCID] && (*HC)[HCID]!=aHC) delete (*HC)[HCID];
     (*HC)[HCID] = aHC;
   }
 }
 
+void G4HCofThisEvent::ClearForReuse()
+{
+  for(size_t i=0;i<HC->size();i++)
+  {
+    G4VHitsCollection* aHC = (*HC)[i];
+    if(aHC && !(aHC->ClearForReuse()))
+    {
+      delete aHC;
+      (*HC)[i] = 0;
+    }
+  }
+}
+
 
 G4HCofThisEvent::G4HCofThisEvent(const G4HCofThisEvent& rhs)
 {
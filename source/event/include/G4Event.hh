@@ -69,6 +69,12 @@ class G4Event
       // Invoke Draw() methods of all stored trajectories, hits, and digits.
       // For hits and digits, Draw() methods of the concrete classes must be
       // implemented. Otherwise nothing will be drawn.
+      void ResetForReuse(G4int evID);
+      // Used by G4RunManager in the event recycling mode. Primary vertices,
+      // digi collections, trajectories, user information and random number
+      // status are deleted, while the G4HCofThisEvent object (with its hits
+      // collections) and the trajectory container are kept to be reused,
+      // with their capacity, by the next event.
 
   private:
       // Copy constructor and = operator must not be used.
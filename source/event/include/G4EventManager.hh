@@ -121,6 +121,11 @@ class G4EventManager
 
       G4StateManager* stateManager;
 
+      G4long nTrackAllocAtBeginOfEvent;
+      G4long nTrackFreeAtBeginOfEvent;
+      G4long nTrackAllocInEvent;
+      G4long nTrackFreeInEvent;
+
   public: // with description
       inline const G4Event* GetConstCurrentEvent()
       { return currentEvent; }
@@ -187,6 +192,25 @@ class G4EventManager
       { transformer = tf; }
       inline void StoreRandomNumberStatusToG4Event(G4int vl)
       { storetRandomNumberStatusToG4Event = vl; }
+
+      inline G4long GetNumberOfTracksAllocated() const
+      {
+        return currentEvent
+          ? G4Track::GetNumberOfAllocatedTracks() - nTrackAllocAtBeginOfEvent
+          : nTrackAllocInEvent;
+      }
+      inline G4long GetNumberOfTracksDeleted() const
+      {
+        return currentEvent
+          ? G4Track::GetNumberOfDeletedTracks() - nTrackFreeAtBeginOfEvent
+          : nTrackFreeInEvent;
+      }
+      inline G4int GetNumberOfStackedTracks() const
+      { return trackContainer->GetNPushedTrack(); }
+      // Numbers of G4Track objects allocated and deleted, and of tracks
+      // pushed to a stack (tracks killed by ClassifyNewTrack() are not
+      // counted), in the current event, or in the last processed event
+      // if no event is being processed.
 };
 
 
@@ -44,6 +44,9 @@
 #include "evmandefs.hh"
 
 class G4StackingMessenger;
+class G4ParticleDefinition;
+class G4LogicalVolume;
+class G4Region;
 class G4VTrajectory;
 
 // class description:
@@ -99,6 +102,18 @@ class G4StackManager
       // If the destination is fKill, tracks are deleted.
       // If the origin is fKill, nothing happen.
 
+      void SetBasketMode(G4int value);
+      void SetBasketDepth(G4int value);
+      //  In basket mode the next urgent track is preferably one of the
+      // same particle type and in the same logical volume (mode 1) or
+      // in the same region (mode 2) as the previous one, searched among
+      // the top 'depth' tracks of the urgent stack, so that tracks sharing
+      // process and geometry state are transported one after the other.
+      // Mode 0 (default) is the plain LIFO order. Tracks are still
+      // transported one by one and all user action methods are invoked
+      // as usual. Not available with G4_USESMARTSTACK, which already
+      // groups tracks by particle type.
+
       void TransferOneStackedTrack(G4ClassificationOfNewTrack origin, G4ClassificationOfNewTrack destination);
       //  Transfter one stacked track from the origin stack to the destination stack.
       // The transfered track is the one which came last to the origin stack.
@@ -119,6 +134,14 @@ class G4StackManager
       G4StackingMessenger* theMessenger;
       std::vector<G4TrackStack*> additionalWaitingStacks;
       G4int numberOfAdditionalWaitingStacks;
+      G4int basketMode;
+      G4int basketDepth;
+      const G4ParticleDefinition* basketParticle;
+      const G4LogicalVolume* basketVolume;
+      const G4Region* basketRegion;
+      G4int maxNUrgentTrack;
+      G4int maxNTotalTrack;
+      G4int nPushedTrack;
 
   public:
       void clear();
@@ -131,9 +154,24 @@ class G4StackManager
       G4int GetNPostponedTrack() const;
       void SetVerboseLevel( G4int const value );
       void SetUserStackingAction(G4UserStackingAction* value);
+      G4int GetBasketMode() const { return basketMode; }
+      G4int GetBasketDepth() const { return basketDepth; }
+      G4int GetMaxNUrgentTrack() const { return maxNUrgentTrack; }
+      G4int GetMaxNTotalTrack() const { return maxNTotalTrack; }
+      G4double GetMaxStackMemory() const;
+      //  Largest numbers of tracks in the urgent stack and in all stacks
+      // during the current (or last) event, and the corresponding memory
+      // estimate in bytes for the stacked G4Track objects.
+      G4int GetNPushedTrack() const { return nPushedTrack; }
+      //  Number of tracks pushed to a stack by PushOneTrack() during the
+      // current (or last) event; tracks killed by the classification are
+      // not counted.
   
   private:
      G4ClassificationOfNewTrack DefaultClassification(G4Track *aTrack);
+     void UpdateMaxNTrack();
+     //  Updates the maximum numbers of tracks after tracks were pushed
+     // or moved between the stacks.
 };
 
 #endif
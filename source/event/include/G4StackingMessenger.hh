@@ -44,6 +44,8 @@ class G4UIcmdWithAnInteger;
 //   /event/stack/status
 //   /event/stack/clear
 //   /event/stack/verbose
+//   /event/stack/basketMode
+//   /event/stack/basketDepth
 
 class G4StackingMessenger: public G4UImessenger
 {
@@ -51,12 +53,15 @@ class G4StackingMessenger: public G4UImessenger
     G4StackingMessenger(G4StackManager* fCont);
     ~G4StackingMessenger();
     void SetNewValue(G4UIcommand * command,G4String newValues);
+    G4String GetCurrentValue(G4UIcommand * command);
   private:
     G4StackManager * fContainer;
     G4UIdirectory* stackDir;
     G4UIcmdWithoutParameter* statusCmd;
     G4UIcmdWithAnInteger* clearCmd;
     G4UIcmdWithAnInteger* verboseCmd;
+    G4UIcmdWithAnInteger* basketModeCmd;
+    G4UIcmdWithAnInteger* basketDepthCmd;
 };
 
 #endif
@@ -39,6 +39,9 @@
 #include <vector>
 
 class G4SmartTrackStack;
+class G4ParticleDefinition;
+class G4LogicalVolume;
+class G4Region;
 
 // class description:
 //
@@ -61,6 +64,13 @@ private:
 public:
 	void PushToStack(const G4StackedTrack& aStackedTrack) { push_back(aStackedTrack); }
 	G4StackedTrack PopFromStack() { G4StackedTrack st = back(); pop_back(); return st; }
+	G4StackedTrack PopFromBasket(const G4ParticleDefinition* aDefinition,
+	                             const G4LogicalVolume* aVolume,
+	                             const G4Region* aRegion, G4int depth);
+	// Pops the most recently stacked track of the given particle type
+	// located in the given logical volume, or in the given region if
+	// aRegion is not null, searching at most 'depth' tracks from the top.
+	// The top track is popped if none matches.
 	void TransferTo(G4TrackStack* aStack);
 	void TransferTo(G4SmartTrackStack* aStack);
   
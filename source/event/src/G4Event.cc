@@ -84,6 +84,35 @@ G4Event::~G4Event()
   delete randomNumberStatusForProcessing;
 }
 
+void G4Event::ResetForReuse(G4int evID)
+{
+  G4PrimaryVertex* nextVertex = thePrimaryVertex;
+  while(nextVertex)
+  {
+    G4PrimaryVertex* thisVertex = nextVertex;
+    nextVertex = thisVertex->GetNext();
+    thisVertex->ClearNext();
+    delete thisVertex;
+  }
+  thePrimaryVertex = nullptr;
+  numberOfPrimaryVertex = 0;
+  delete DC;
+  DC = nullptr;
+  if(trajectoryContainer) trajectoryContainer->clearAndDestroy();
+  delete userInfo;
+  userInfo = nullptr;
+  delete randomNumberStatus;
+  randomNumberStatus = nullptr;
+  validRandomNumberStatus = false;
+  delete randomNumberStatusForProcessing;
+  randomNumberStatusForProcessing = nullptr;
+  validRandomNumberStatusForProcessing = false;
+  eventAborted = false;
+  keepTheEvent = false;
+  grips = 0;
+  eventID = evID;
+}
+
 G4int G4Event::operator==(const G4Event &right) const
 {
   return ( eventID == right.eventID );
@@ -49,7 +49,9 @@ G4EventManager* G4EventManager::GetEventManager()
 G4EventManager::G4EventManager()
 :currentEvent(nullptr),trajectoryContainer(nullptr),
  verboseLevel(0),tracking(false),abortRequested(false),
- storetRandomNumberStatusToG4Event(false)
+ storetRandomNumberStatusToG4Event(false),
+ nTrackAllocAtBeginOfEvent(0),nTrackFreeAtBeginOfEvent(0),
+ nTrackAllocInEvent(0),nTrackFreeInEvent(0)
 {
  if(fpEventManager)
  {
@@ -108,6 +110,8 @@ void G4EventManager::DoProcessing(G4Event* anEvent)
   }
   currentEvent = anEvent;
   stateManager->SetNewState(G4State_EventProc);
+  nTrackAllocAtBeginOfEvent = G4Track::GetNumberOfAllocatedTracks();
+  nTrackFreeAtBeginOfEvent = G4Track::GetNumberOfDeletedTracks();
   if(storetRandomNumberStatusToG4Event>1)
   {
     std::ostringstream oss;
@@ -138,12 +142,14 @@ void G4EventManager::DoProcessing(G4Event* anEvent)
   trackContainer->PrepareNewEvent();
 
 #ifdef G4_STORE_TRAJECTORY
-  trajectoryContainer = nullptr;
+  // non-null only for an event recycled by G4RunManager
+  trajectoryContainer = currentEvent->GetTrajectoryContainer();
 #endif
 
   sdManager = G4SDManager::GetSDMpointerIfExist();
   if(sdManager)
-  { currentEvent->SetHCofThisEvent(sdManager->PrepareNewEvent()); }
+  { currentEvent->SetHCofThisEvent(
+      sdManager->PrepareNewEvent(currentEvent->GetHCofThisEvent())); }
 
   if(userEventAction) userEventAction->BeginOfEventAction(currentEvent);
 
@@ -261,6 +267,21 @@ void G4EventManager::DoProcessing(G4Event* anEvent)
 
   if(userEventAction) userEventAction->EndOfEventAction(currentEvent);
 
+  nTrackAllocInEvent = G4Track::GetNumberOfAllocatedTracks() - nTrackAllocAtBeginOfEvent;
+  nTrackFreeInEvent = G4Track::GetNumberOfDeletedTracks() - nTrackFreeAtBeginOfEvent;
+#ifdef G4VERBOSE
+  if ( verboseLevel > 0 )
+  {
+    G4cout << "  " << trackContainer->GetNPushedTrack() << " tracks stacked, "
+           << nTrackAllocInEvent << " G4Track objects allocated and "
+           << nTrackFreeInEvent << " deleted in this event." << G4endl;
+    G4cout << "  Maximum stack depth : " << trackContainer->GetMaxNUrgentTrack()
+           << " urgent, " << trackContainer->GetMaxNTotalTrack()
+           << " in all stacks (about " << trackContainer->GetMaxStackMemory()/1024.
+           << " kB)." << G4endl;
+  }
+#endif
+
   stateManager->SetNewState(G4State_GeomClosed);
   currentEvent = nullptr;
   abortRequested = false;
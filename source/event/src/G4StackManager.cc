@@ -33,11 +33,14 @@
 #include "G4StackManager.hh"
 #include "G4StackingMessenger.hh"
 #include "G4VTrajectory.hh"
+#include "G4VPhysicalVolume.hh"
 #include "evmandefs.hh"
 #include "G4ios.hh"
 
 G4StackManager::G4StackManager()
-:userStackingAction(0),verboseLevel(0),numberOfAdditionalWaitingStacks(0)
+:userStackingAction(0),verboseLevel(0),numberOfAdditionalWaitingStacks(0),
+ basketMode(0),basketDepth(1000),basketParticle(0),basketVolume(0),
+ basketRegion(0),maxNUrgentTrack(0),maxNTotalTrack(0),nPushedTrack(0)
 {
   theMessenger = new G4StackingMessenger(this);
 #ifdef G4_USESMARTSTACK
@@ -206,6 +209,8 @@ G4int G4StackManager::PushOneTrack(G4Track *newTrack,G4VTrajectory *newTrajector
         }
         break;
     }
+    nPushedTrack++;
+    UpdateMaxNTrack();
   }
 
   return GetNUrgentTrack();
@@ -239,6 +244,7 @@ G4Track * G4StackManager::PopNextTrack(G4VTrajectory**newTrajectory)
       }
     }
     if(userStackingAction) userStackingAction->NewStage();
+    UpdateMaxNTrack();
 #ifdef G4VERBOSE
     if( verboseLevel > 1 ) G4cout << "     " << GetNUrgentTrack()
                       << " urgent tracks and " << GetNWaitingTrack()
@@ -247,10 +253,24 @@ G4Track * G4StackManager::PopNextTrack(G4VTrajectory**newTrajectory)
     if( ( GetNUrgentTrack()==0 ) && ( GetNWaitingTrack()==0 ) ) return 0;
   }
 
+#ifdef G4_USESMARTSTACK
   G4StackedTrack selectedStackedTrack = urgentStack->PopFromStack();
+#else
+  G4StackedTrack selectedStackedTrack = basketMode
+    ? urgentStack->PopFromBasket(basketParticle,basketVolume,basketRegion,basketDepth)
+    : urgentStack->PopFromStack();
+#endif
   G4Track * selectedTrack = selectedStackedTrack.GetTrack();
   *newTrajectory = selectedStackedTrack.GetTrajectory();
 
+  if(basketMode)
+  {
+    basketParticle = selectedTrack->GetDefinition();
+    G4VPhysicalVolume* pv = selectedTrack->GetVolume();
+    basketVolume = pv ? pv->GetLogicalVolume() : 0;
+    basketRegion = (basketMode==2 && basketVolume) ? basketVolume->GetRegion() : 0;
+  }
+
 #ifdef G4VERBOSE
   if( verboseLevel > 2 )
   {
@@ -307,6 +327,7 @@ void G4StackManager::ReClassify()
         break;
     }
   }
+  UpdateMaxNTrack();
 }
 
 G4int G4StackManager::PrepareNewEvent()
@@ -314,6 +335,9 @@ G4int G4StackManager::PrepareNewEvent()
   if(userStackingAction) userStackingAction->PrepareNewEvent();
   
   urgentStack->clearAndDestroy(); // Set the urgentStack in a defined state. Not doing it would affect reproducibility.
+  maxNUrgentTrack = 0;
+  maxNTotalTrack = 0;
+  nPushedTrack = 0;
   
   G4int n_passedFromPrevious = 0;
   
@@ -378,6 +402,8 @@ G4int G4StackManager::PrepareNewEvent()
     }
   }
   
+  // tracks passed from the previous event are not pushed by PushOneTrack
+  UpdateMaxNTrack();
   return n_passedFromPrevious;
 }
 
@@ -459,6 +485,7 @@ void G4StackManager::TransferStackedTracks(G4ClassificationOfNewTrack origin, G4
     else
     { urgentStack->TransferTo(targetStack); }
   }
+  UpdateMaxNTrack();
   return;
 }
 
@@ -528,6 +555,7 @@ void G4StackManager::TransferOneStackedTrack(G4ClassificationOfNewTrack origin,
       else            { urgentStack->PushToStack(aStackedTrack); }
     }
   }
+  UpdateMaxNTrack();
   return;
 }
 
@@ -588,6 +616,41 @@ void G4StackManager::SetVerboseLevel( G4int const value )
   verboseLevel = value;
 }
 
+void G4StackManager::SetBasketMode(G4int value)
+{
+#ifdef G4_USESMARTSTACK
+  if(value)
+  {
+    G4Exception("G4StackManager::SetBasketMode","Event0054",JustWarning,
+                "Basket mode is not available with G4SmartTrackStack. Command ignored.");
+  }
+#else
+  basketMode = (value>=0 && value<=2) ? value : 0;
+  basketParticle = 0;
+  basketVolume = 0;
+  basketRegion = 0;
+#endif
+}
+
+void G4StackManager::UpdateMaxNTrack()
+{
+  G4int nUrgent = GetNUrgentTrack();
+  if(nUrgent > maxNUrgentTrack) maxNUrgentTrack = nUrgent;
+  G4int nTotal = GetNTotalTrack();
+  if(nTotal > maxNTotalTrack) maxNTotalTrack = nTotal;
+}
+
+G4double G4StackManager::GetMaxStackMemory() const
+{
+  return G4double(maxNTotalTrack)
+    * (sizeof(G4Track) + sizeof(G4DynamicParticle) + sizeof(G4StackedTrack));
+}
+
+void G4StackManager::SetBasketDepth(G4int value)
+{
+  basketDepth = (value > 0) ? value : 1;
+}
+
 void G4StackManager::SetUserStackingAction(G4UserStackingAction* value)
 {
 	userStackingAction = value;
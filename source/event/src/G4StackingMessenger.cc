@@ -63,6 +63,23 @@ G4StackingMessenger::G4StackingMessenger(G4StackManager * fCont)
   verboseCmd->SetGuidance(" 2 : Detailed reports");
   verboseCmd->SetGuidance("Note - this value is overwritten by /event/verbose command.");
 
+  basketModeCmd = new G4UIcmdWithAnInteger("/event/stack/basketMode",this);
+  basketModeCmd->SetGuidance("Pop urgent tracks in baskets of the same particle type");
+  basketModeCmd->SetGuidance("and location, so that such tracks are transported one");
+  basketModeCmd->SetGuidance("after the other. Tracks are still processed one by one.");
+  basketModeCmd->SetGuidance(" 0 : plain LIFO order (default)");
+  basketModeCmd->SetGuidance(" 1 : baskets by particle type and logical volume");
+  basketModeCmd->SetGuidance(" 2 : baskets by particle type and region");
+  basketModeCmd->SetGuidance("Not available if G4_USESMARTSTACK is defined.");
+  basketModeCmd->SetParameterName("mode",true);
+  basketModeCmd->SetDefaultValue(1);
+  basketModeCmd->SetRange("mode>=0&&mode<=2");
+
+  basketDepthCmd = new G4UIcmdWithAnInteger("/event/stack/basketDepth",this);
+  basketDepthCmd->SetGuidance("Maximum number of urgent tracks searched for the next");
+  basketDepthCmd->SetGuidance("member of the current basket (default 1000).");
+  basketDepthCmd->SetParameterName("depth",false);
+  basketDepthCmd->SetRange("depth>0");
 }
 
 G4StackingMessenger::~G4StackingMessenger()
@@ -70,6 +87,8 @@ G4StackingMessenger::~G4StackingMessenger()
   delete statusCmd;
   delete clearCmd;
   delete verboseCmd;
+  delete basketModeCmd;
+  delete basketDepthCmd;
   delete stackDir;
 }
 
@@ -82,6 +101,10 @@ void G4StackingMessenger::SetNewValue(G4UIcommand * command,G4String newValues)
     G4cout << "    Urgent stack    : " << fContainer->GetNUrgentTrack() << G4endl;
     G4cout << "    Waiting stack   : " << fContainer->GetNWaitingTrack() << G4endl;
     G4cout << "    Postponed stack : " << fContainer->GetNPostponedTrack() << G4endl;
+    G4cout << " Maximum number of tracks in this event" << G4endl;
+    G4cout << "    Urgent stack    : " << fContainer->GetMaxNUrgentTrack() << G4endl;
+    G4cout << "    All stacks      : " << fContainer->GetMaxNTotalTrack()
+           << " (about " << fContainer->GetMaxStackMemory()/1024. << " kB)" << G4endl;
   }
   else if( command==clearCmd )
   {
@@ -107,5 +130,23 @@ void G4StackingMessenger::SetNewValue(G4UIcommand * command,G4String newValues)
   {
     fContainer->SetVerboseLevel(verboseCmd->GetNewIntValue(newValues));
   }
+  else if( command==basketModeCmd )
+  {
+    fContainer->SetBasketMode(basketModeCmd->GetNewIntValue(newValues));
+  }
+  else if( command==basketDepthCmd )
+  {
+    fContainer->SetBasketDepth(basketDepthCmd->GetNewIntValue(newValues));
+  }
+}
+
+G4String G4StackingMessenger::GetCurrentValue(G4UIcommand * command)
+{
+  G4String cv;
+  if( command==basketModeCmd )
+  { cv = basketModeCmd->ConvertToString(fContainer->GetBasketMode()); }
+  else if( command==basketDepthCmd )
+  { cv = basketDepthCmd->ConvertToString(fContainer->GetBasketDepth()); }
+  return cv;
 }
 
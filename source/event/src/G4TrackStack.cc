@@ -31,6 +31,9 @@
 #include "G4SmartTrackStack.hh"
 #include "G4VTrajectory.hh"
 #include "G4Track.hh"
+#include "G4VPhysicalVolume.hh"
+
+#include <algorithm>
 
 G4TrackStack::~G4TrackStack()
 {
@@ -52,6 +55,28 @@ void G4TrackStack::TransferTo(G4TrackStack* aStack) {
 }
 
 
+G4StackedTrack G4TrackStack::PopFromBasket(const G4ParticleDefinition* aDefinition,
+                                           const G4LogicalVolume* aVolume,
+                                           const G4Region* aRegion,
+                                           G4int depth)
+{
+  G4int n = size();
+  G4int nmin = (depth < n) ? n - depth : 0;
+  for(G4int i = n; i > nmin; --i) {
+    const G4Track* aTrack = (*this)[i-1].GetTrack();
+    if(aTrack->GetDefinition() != aDefinition) continue;
+    const G4VPhysicalVolume* aPV = aTrack->GetVolume();
+    const G4LogicalVolume* aLV = aPV ? aPV->GetLogicalVolume() : 0;
+    if(aRegion) {
+      if(!aLV || aLV->GetRegion() != aRegion) continue;
+    } else if(aLV != aVolume) continue;
+    // Move the matching track to the top, keeping the order of the others
+    if(i < n) std::rotate(begin()+(i-1), begin()+i, end());
+    break;
+  }
+  return PopFromStack();
+}
+
 void G4TrackStack::TransferTo(G4SmartTrackStack * aStack)
 {
   while(size()) { aStack->PushToStack(PopFromStack()); }
@@ -39,6 +39,7 @@
 
 // History:
 // - Created.                                  Paul Kent,     Jul 95/96
+// - Added ComputeStep/Locate call counters                   Oct  2026
 // - Zero step protections                     J.A. / G.C.,   Nov  2004
 // - Added check mode                          G. Cosmo,      Mar  2004
 // - Made Navigator Abstract                   G. Cosmo,      Nov  2003
@@ -243,6 +244,11 @@ class G4Navigator
     // Get/Set Verbose(ness) level.
     // [if level>0 && G4VERBOSE, printout can occur]
 
+  inline G4long GetNumberOfComputeStepCalls() const;
+  inline G4long GetNumberOfLocateCalls() const;
+    // Number of calls to ComputeStep() and to LocateGlobalPointAndSetup()
+    // or LocateGlobalPointWithinVolume() since the construction.
+
   inline G4bool IsActive() const;
     // Verify if the navigator is active.
   inline void  Activate(G4bool flag);
@@ -451,6 +457,10 @@ class G4Navigator
   G4int fAbandonThreshold_NoZeroSteps; 
     // After this many failed/zero steps, abandon track
 
+  G4long fNumberComputeStepCalls;
+  G4long fNumberLocateCalls;
+    // Call counters, for profiling
+
   G4ThreeVector  fPreviousSftOrigin;
   G4double       fPreviousSafety; 
     // Memory of last safety origin & value. Used in ComputeStep to ensure
@@ -66,6 +66,9 @@ G4Navigator::G4Navigator()
   fActionThreshold_NoZeroSteps  = 10; 
   fAbandonThreshold_NoZeroSteps = 25; 
 
+  fNumberComputeStepCalls = 0;
+  fNumberLocateCalls = 0;
+
   kCarTolerance = G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
   fMinStep = 0.05*kCarTolerance;
   fSqTol = kCarTolerance*kCarTolerance;
@@ -134,6 +137,8 @@ G4Navigator::LocateGlobalPointAndSetup( const G4ThreeVector& globalPoint,
   G4ThreeVector localPoint, globalDirection;
   EInside insideCode;
   
+  ++fNumberLocateCalls;
+
   G4bool considerDirection = (!ignoreDirection) || fLocatedOnEdge;
 
   fLastTriedStepComputation=   false;   
@@ -587,6 +592,8 @@ G4Navigator::LocateGlobalPointWithinVolume(const G4ThreeVector& pGlobalpoint)
    assert( !fWasLimitedByGeometry );
 #endif
   
+   ++fNumberLocateCalls;
+
    fLastLocatedPointLocal = ComputeLocalPoint(pGlobalpoint);
    fLastTriedStepComputation= false;
    fChangedGrandMotherRefFrame= false;  //  Frame for Exit Normal
@@ -754,6 +761,8 @@ G4double G4Navigator::ComputeStep( const G4ThreeVector &pGlobalpoint,
   G4VPhysicalVolume  *motherPhysical = fHistory.GetTopVolume();
   G4LogicalVolume *motherLogical = motherPhysical->GetLogicalVolume();
 
+  ++fNumberComputeStepCalls;
+
   // All state relating to exiting normals must be reset
   //
   fExitNormalGlobalFrame= G4ThreeVector( 0., 0., 0.);
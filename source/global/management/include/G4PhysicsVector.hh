@@ -57,6 +57,7 @@
 //    16 Aug. 2011  H.Kurashige  : Add dBin, baseBin and verboseLevel
 //    02 Oct. 2013  V.Ivanchenko : FindBinLocation method become inlined;
 //                                 instead of G4Pow G4Log is used
+//    19 Oct. 2026  : Added optional compact single precision storage
 //---------------------------------------------------------------
 
 #ifndef G4PhysicsVector_h
@@ -70,8 +71,10 @@
 #include "G4ios.hh"
 #include "G4PhysicsVectorType.hh"
 #include "G4Log.hh"
+#include "G4Exp.hh"
 
 typedef std::vector<G4double> G4PVDataVector;
+typedef std::vector<G4float>  G4PVCompactDataVector;
 
 class G4PhysicsVector 
 {
@@ -194,6 +197,21 @@ class G4PhysicsVector
 
     inline void SetVerboseLevel(G4int value);
 
+    G4double Compact();
+         // Convert data and second derivatives to single precision and
+         // release double precision storage. For log-vectors the energy 
+         // grid is released too, if it can be recomputed exactly from 
+         // the vector parameters. Returns maximal relative deviation 
+         // of the compact vector from the original one computed at nodes
+         // and in the middle of bins. The vector can be used as before; 
+         // any method modifying data restores double precision storage.
+         // Only log-vectors are compacted, for other types nothing is done
+
+    inline G4bool IsCompact() const;
+
+    size_t GetMemorySize() const;
+         // Number of bytes used by data of the vector
+
   protected:
 
     void DeleteData();
@@ -202,6 +220,9 @@ class G4PhysicsVector
 
     void PrintPutValueError(size_t index);
 
+    void Expand();
+         // Restore double precision storage of a compact vector
+
   protected:
 
     G4PhysicsVectorType type;   // The type of PhysicsVector (enumerator)
@@ -230,8 +251,20 @@ class G4PhysicsVector
          // find low edge index of a bin for given energy
          // min value 0, max value VectorLength-1
 
+    inline G4double CompactInterpolation(size_t idx, G4double energy) const;
+         // Linear or spline interpolation using single precision data
+
+    inline G4double ComputedEnergy(size_t index) const;
+         // Energy of a node of a log-vector recomputed from dBin and baseBin
+
     G4bool     useSpline;
 
+    G4bool     isCompact;      // Data are kept in single precision
+    G4bool     gridComputed;   // Energy grid is not stored
+
+    G4PVCompactDataVector compactData;          
+    G4PVCompactDataVector compactSecDerivative;
+
   protected:
 
     G4double dBin;          // Bin width - useful only for fixed binning
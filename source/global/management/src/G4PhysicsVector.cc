@@ -51,6 +51,7 @@
 //    04 May  2010  H.Kurashige   : use G4PhyscisVectorCache
 //    28 May  2010  H.Kurashige  : Stop using  pointers to G4PVDataVector
 //    16 Aug. 2011  H.Kurashige  : Add dBin, baseBin and verboseLevel
+//    19 Oct. 2026  : Added Compact(), Expand() and GetMemorySize()
 // --------------------------------------------------------------
 
 #include <iomanip>
@@ -61,7 +62,7 @@
 G4PhysicsVector::G4PhysicsVector(G4bool val)
  : type(T_G4PhysicsVector),
    edgeMin(0.), edgeMax(0.), numberOfNodes(0),
-   useSpline(val), 
+   useSpline(val), isCompact(false), gridComputed(false),
    dBin(0.), baseBin(0.),
    verboseLevel(0)
 {}
@@ -117,6 +118,10 @@ void G4PhysicsVector::DeleteData()
 {
   useSpline = false;
   secDerivative.clear();
+  isCompact = false;
+  gridComputed = false;
+  G4PVCompactDataVector().swap(compactData);
+  G4PVCompactDataVector().swap(compactSecDerivative);
 }
 
 // --------------------------------------------------------------
@@ -129,16 +134,26 @@ void G4PhysicsVector::CopyData(const G4PhysicsVector& vec)
   numberOfNodes = vec.numberOfNodes;
   useSpline = vec.useSpline;
 
+  // a copy of compact vector is always not compact
+  isCompact = false;
+  gridComputed = false;
+
   size_t i;
   dataVector.resize(numberOfNodes);
   for(i=0; i<numberOfNodes; ++i) { 
-    dataVector[i] = (vec.dataVector)[i];
+    dataVector[i] = vec[i];
   }
   binVector.resize(numberOfNodes);
   for(i=0; i<numberOfNodes; ++i) { 
-    binVector[i] = (vec.binVector)[i];
+    binVector[i] = vec.Energy(i);
   }
-  if(0 < (vec.secDerivative).size()) {
+  if(vec.isCompact) {
+    size_t n = (vec.compactSecDerivative).size();
+    secDerivative.resize(n);
+    for(i=0; i<n; ++i){ 
+      secDerivative[i] = (vec.compactSecDerivative)[i];
+    }
+  } else if(0 < (vec.secDerivative).size()) {
     secDerivative.resize(numberOfNodes);
     for(i=0; i<numberOfNodes; ++i){ 
       secDerivative[i] = (vec.secDerivative)[i];
@@ -150,7 +165,7 @@ void G4PhysicsVector::CopyData(const G4PhysicsVector& vec)
 
 G4double G4PhysicsVector::GetLowEdgeEnergy(size_t binNumber) const
 {
-  return binVector[binNumber];
+  return Energy(binNumber);
 }
 
 // --------------------------------------------------------------
@@ -171,14 +186,14 @@ G4bool G4PhysicsVector::Store(std::ofstream& fOut, G4bool ascii) const
   fOut.write((char*)(&numberOfNodes), sizeof numberOfNodes);
 
   // contents
-  size_t size = dataVector.size(); 
+  size_t size = numberOfNodes; 
   fOut.write((char*)(&size), sizeof size);
 
   G4double* value = new G4double[2*size];
   for(size_t i = 0; i < size; ++i)
   {
-    value[2*i]  =  binVector[i];
-    value[2*i+1]=  dataVector[i];
+    value[2*i]  =  Energy(i);
+    value[2*i+1]=  (*this)[i];
   }
   fOut.write((char*)(value), 2*size*(sizeof (G4double)));
   delete [] value;
@@ -194,6 +209,10 @@ G4bool G4PhysicsVector::Retrieve(std::ifstream& fIn, G4bool ascii)
   dataVector.clear();
   binVector.clear();
   secDerivative.clear();
+  isCompact = false;
+  gridComputed = false;
+  compactData.clear();
+  compactSecDerivative.clear();
 
   // retrieve in ascii mode
   if (ascii){
@@ -267,7 +286,7 @@ void G4PhysicsVector::DumpValues(G4double unitE, G4double unitV) const
 {
    for (size_t i = 0; i < numberOfNodes; ++i)
    {
-     G4cout << binVector[i]/unitE << "   " << dataVector[i]/unitV << G4endl;
+     G4cout << Energy(i)/unitE << "   " << (*this)[i]/unitV << G4endl;
    }
 }
 
@@ -276,6 +295,7 @@ void G4PhysicsVector::DumpValues(G4double unitE, G4double unitV) const
 void 
 G4PhysicsVector::ScaleVector(G4double factorE, G4double factorV)
 {
+  if(isCompact) { Expand(); }
   size_t n = dataVector.size();
   size_t i;
   for(i=0; i<n; ++i) {
@@ -298,6 +318,7 @@ G4PhysicsVector::ComputeSecondDerivatives(G4double firstPointDerivative,
   //  See for example W.H. Press et al. "Numerical recipes in C"
   //  Cambridge University Press, 1997.
 {
+  if(isCompact) { Expand(); }
   if(4 > numberOfNodes)   // cannot compute derivatives for less than 4 bins
   {
     ComputeSecDerivatives();
@@ -361,6 +382,7 @@ void G4PhysicsVector::FillSecondDerivatives()
   // B.I. Kvasov "Methods of shape-preserving spline approximation"
   // World Scientific, 2000
 {
+  if(isCompact) { Expand(); }
   if(5 > numberOfNodes)  // cannot compute derivatives for less than 4 points
   {
     ComputeSecDerivatives();
@@ -431,6 +453,7 @@ void
 G4PhysicsVector::ComputeSecDerivatives()
   //  A simplified method of computation of second derivatives 
 {
+  if(isCompact) { Expand(); }
   if(3 > numberOfNodes)  // cannot compute derivatives for less than 4 bins
   {
     useSpline = false;
@@ -483,10 +506,10 @@ std::ostream& operator<<(std::ostream& out, const G4PhysicsVector& pv)
       << pv.edgeMax << " " << pv.numberOfNodes << G4endl; 
 
   // contents
-  out << pv.dataVector.size() << G4endl; 
-  for(size_t i = 0; i < pv.dataVector.size(); i++)
+  out << pv.numberOfNodes << G4endl; 
+  for(size_t i = 0; i < pv.numberOfNodes; i++)
   {
-    out << pv.binVector[i] << "  " << pv.dataVector[i] << G4endl;
+    out << pv.Energy(i) << "  " << pv[i] << G4endl;
   }
   out << std::setprecision(6);
 
@@ -500,10 +523,10 @@ G4double G4PhysicsVector::Value(G4double theEnergy, size_t& lastIdx) const
   G4double y;
   if(theEnergy <= edgeMin) {
     lastIdx = 0; 
-    y = dataVector[0]; 
+    y = (*this)[0]; 
   } else if(theEnergy >= edgeMax) { 
     lastIdx = numberOfNodes-1; 
-    y = dataVector[lastIdx]; 
+    y = (*this)[lastIdx]; 
   } else {
     lastIdx = FindBin(theEnergy, lastIdx);
     y = Interpolation(lastIdx, theEnergy);
@@ -516,20 +539,110 @@ G4double G4PhysicsVector::Value(G4double theEnergy, size_t& lastIdx) const
 G4double G4PhysicsVector::FindLinearEnergy(G4double rand) const
 {
   if(1 >= numberOfNodes) { return 0.0; }
-  G4double y = rand*dataVector[numberOfNodes-1];
-  size_t bin = std::lower_bound(dataVector.begin(), dataVector.end(), y)
-             - dataVector.begin() - 1;
+  G4double y = rand*(*this)[numberOfNodes-1];
+  size_t bin;
+  if(isCompact) {
+    bin = std::lower_bound(compactData.begin(), compactData.end(), y)
+        - compactData.begin() - 1;
+  } else {
+    bin = std::lower_bound(dataVector.begin(), dataVector.end(), y)
+        - dataVector.begin() - 1;
+  }
   bin = std::min(bin, numberOfNodes-2);
-  G4double res = binVector[bin];
-  G4double del = dataVector[bin+1] - dataVector[bin];
+  G4double res = Energy(bin);
+  G4double del = (*this)[bin+1] - (*this)[bin];
   if(del > 0.0) { 
-    res += (y - dataVector[bin])*(binVector[bin+1] - res)/del;  
+    res += (y - (*this)[bin])*(Energy(bin+1) - res)/del;  
   }
   return res;
 }
 
 //---------------------------------------------------------------
 
+G4double G4PhysicsVector::Compact()
+{
+  if(isCompact || type != T_G4PhysicsLogVector || 2 > numberOfNodes 
+     || dataVector.size() != numberOfNodes) { return 0.0; }
+
+  size_t i;
+  compactData.resize(numberOfNodes);
+  for(i=0; i<numberOfNodes; ++i) { compactData[i] = G4float(dataVector[i]); }
+  size_t nsec = useSpline ? secDerivative.size() : 0;
+  compactSecDerivative.resize(nsec);
+  for(i=0; i<nsec; ++i) { 
+    compactSecDerivative[i] = G4float(secDerivative[i]); 
+  }
+
+  // maximal relative deviation at nodes and in the middle of bins
+  G4double dmax = 0.0;
+  for(i=0; i<numberOfNodes; ++i) {
+    G4double y = dataVector[i];
+    if(y != 0.0) { 
+      dmax = std::max(dmax, std::abs(compactData[i]/y - 1.0)); 
+    }
+  }
+  for(i=0; i<numberOfNodes-1; ++i) {
+    G4double e = 0.5*(binVector[i] + binVector[i+1]);
+    G4double y = Interpolation(i, e);
+    if(y != 0.0) {
+      isCompact = true;
+      G4double y1 = CompactInterpolation(i, e);
+      isCompact = false;
+      dmax = std::max(dmax, std::abs(y1/y - 1.0)); 
+    }
+  }
+
+  // energy grid is released only if it can be restored exactly
+  G4bool exact = (0.0 < dBin);
+  for(i=0; i<numberOfNodes; ++i) {
+    if(!exact) { break; }
+    if(ComputedEnergy(i) != binVector[i]) { exact = false; }
+  }
+
+  G4PVDataVector().swap(dataVector);
+  G4PVDataVector().swap(secDerivative);
+  if(exact) { 
+    G4PVDataVector().swap(binVector);
+    gridComputed = true;
+  }
+  isCompact = true;
+  return dmax;
+}
+
+//---------------------------------------------------------------
+
+void G4PhysicsVector::Expand()
+{
+  if(!isCompact) { return; }
+  size_t i;
+  if(gridComputed) {
+    binVector.resize(numberOfNodes);
+    for(i=0; i<numberOfNodes; ++i) { binVector[i] = ComputedEnergy(i); }
+  }
+  dataVector.resize(numberOfNodes);
+  for(i=0; i<numberOfNodes; ++i) { dataVector[i] = compactData[i]; }
+  size_t nsec = compactSecDerivative.size();
+  secDerivative.resize(nsec);
+  for(i=0; i<nsec; ++i) { secDerivative[i] = compactSecDerivative[i]; }
+
+  isCompact = false;
+  gridComputed = false;
+  G4PVCompactDataVector().swap(compactData);
+  G4PVCompactDataVector().swap(compactSecDerivative);
+}
+
+//---------------------------------------------------------------
+
+size_t G4PhysicsVector::GetMemorySize() const
+{
+  return sizeof(G4double)*(dataVector.capacity() + binVector.capacity() 
+                           + secDerivative.capacity()) 
+    + sizeof(G4float)*(compactData.capacity() 
+                       + compactSecDerivative.capacity());
+}
+
+//---------------------------------------------------------------
+
 void G4PhysicsVector::PrintPutValueError(size_t index)
 {
   G4ExceptionDescription ed;
@@ -57,6 +57,9 @@ public:
 
   virtual void Initialise(const G4ParticleDefinition*, const G4DataVector&);
 
+  virtual void InitialiseLocal(const G4ParticleDefinition*,
+                               G4VEmModel* masterModel);
+
   virtual G4double ComputeCrossSectionPerAtom( const G4ParticleDefinition*,
                                                G4double kinEnergy, 
                                                G4double Z, 
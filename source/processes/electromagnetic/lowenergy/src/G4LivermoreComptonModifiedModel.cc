@@ -40,6 +40,7 @@
 //                  - use G4ElementSelector
 // 26 Dec 2010   V Ivanchenko Load data tables only once to avoid memory leak
 // 30 May 2011   V Ivanchenko Migration to model design for deexcitation
+// 19 Oct 2026   Element selectors are built on master and shared
 
 #include "G4LivermoreComptonModifiedModel.hh"
 #include "G4PhysicalConstants.hh"
@@ -122,7 +123,7 @@ void G4LivermoreComptonModifiedModel::Initialise(const G4ParticleDefinition* par
   G4String file = "/doppler/shell-doppler";
   shellData.LoadData(file);
 
-  InitialiseElementSelectors(particle,cuts);
+  if(IsMaster()) { InitialiseElementSelectors(particle,cuts); }
 
   if (verboseLevel > 2) {
     G4cout << "Loaded cross section files for Livermore Modified Compton model" << G4endl;
@@ -146,6 +147,14 @@ void G4LivermoreComptonModifiedModel::Initialise(const G4ParticleDefinition* par
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+void G4LivermoreComptonModifiedModel::InitialiseLocal(
+     const G4ParticleDefinition*, G4VEmModel* masterModel)
+{
+  SetElementSelectors(masterModel->GetElementSelectors());
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 G4double G4LivermoreComptonModifiedModel::ComputeCrossSectionPerAtom(
                                        const G4ParticleDefinition*,
                                              G4double GammaEnergy,
@@ -48,6 +48,7 @@
 // 26-07-06, cross section recalculated (P.Starovoitov)
 // 09-08-06, make it work under current geant4 release (A.Schalicke)
 // 11-06-07, add PostStepGetPhysicalInteractionLength (A.Schalicke)
+// 19-10-26, step limit is not fused with other processes
 //
 // -----------------------------------------------------------------------------
 
@@ -87,6 +88,9 @@ public:  // with description
 
   void SetModel(const G4String& name);
 
+  // false: the step limit depends on the polarisation
+  virtual G4bool AllowFusedStepLimit() const override;
+
 protected:
 
   virtual void InitialiseProcess(const G4ParticleDefinition*) override;
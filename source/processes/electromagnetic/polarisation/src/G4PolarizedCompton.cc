@@ -50,6 +50,7 @@
 // 26-07-06, cross section recalculated (P.Starovoitov)
 // 09-08-06, make it work under current geant4 release (A.Schalicke)
 // 11-06-07, add PostStepGetPhysicalInteractionLength (A.Schalicke)
+// 19-10-26, added AllowFusedStepLimit()
 // -----------------------------------------------------------------------------
 
 
@@ -209,6 +210,13 @@ G4double G4PolarizedCompton::PostStepGetPhysicalInteractionLength(
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+G4bool G4PolarizedCompton::AllowFusedStepLimit() const
+{
+  return false;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 G4double G4PolarizedCompton::ComputeSaturationFactor(const G4Track& aTrack)
 {
   G4double factor = 1.0;
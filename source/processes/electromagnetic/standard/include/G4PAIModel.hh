@@ -118,6 +118,8 @@ public:
 
   inline G4double ComputeMaxEnergy(G4double scaledEnergy);
 
+  inline const G4ParticleDefinition* GetParticle() const;
+
   inline void SetVerboseLevel(G4int verbose);
 
 protected:
@@ -168,6 +170,11 @@ inline G4double G4PAIModel::ComputeMaxEnergy(G4double scaledEnergy)
   return MaxSecondaryEnergy(fParticle, scaledEnergy/fRatio);
 }
 
+inline const G4ParticleDefinition* G4PAIModel::GetParticle() const
+{
+  return fParticle;
+}
+
 inline void G4PAIModel::SetVerboseLevel(G4int verbose) 
 { 
   fVerbose=verbose; 
@@ -38,6 +38,8 @@
 //
 // Modifications:
 //
+// 19.10.26 Tables of the same material are shared between couples, 
+//          parallel computation of vectors and binary file cache
 // 04.10.13 V. Grichine add cut of dE/dx, redirect <dE/dx> to   std::vector<G4PhysicsLogVector*>  fdEdxTable;
 //
 //
@@ -59,12 +61,30 @@
 #include "globals.hh"
 #include "G4PAIySection.hh"
 #include "G4SandiaTable.hh"
+#include "G4Threading.hh"
 
 class G4PhysicsLogVector;
+class G4PhysicsFreeVector;
 class G4PhysicsTable;
 class G4MaterialCutsCouple;
+class G4Material;
 class G4PAIModel;
 
+// input and output of one thread computing PAI vectors of a material
+struct G4PAIModelDataTask
+{
+  G4PAIySection* section;
+  G4SandiaTable* sandia;
+  const G4Material* material;
+  const std::vector<G4double>* energy;
+  const std::vector<G4double>* tmax;
+  std::vector<G4PhysicsFreeVector*>* transfer;
+  std::vector<G4PhysicsFreeVector*>* dedx;
+  std::vector<G4double>* ionloss;
+  size_t first;
+  size_t stride;
+};
+
 class G4PAIModelData 
 {
 
@@ -96,11 +116,41 @@ private:
   G4double GetEnergyTransfer(G4int coupleIndex, size_t iPlace, 
 			     G4double position) const;
 
+  // computation of vectors for energy nodes of one task
+  static G4ThreadFunReturnType ComputeVectors(G4ThreadFunArgType arg);
+
+  void BuildTables(const G4Material*, const std::vector<G4double>& tmax,
+                   G4PhysicsTable* transferTable, G4PhysicsTable* dedxTable,
+                   G4PhysicsLogVector* dedxMean);
+
+  // binary file with tables of a material, the header contains 
+  // material properties and the energy grid
+  G4String FileName(const G4Material*, const G4PAIModel*) const;
+
+  void WriteHeader(std::ofstream&, const G4Material*, 
+                   const std::vector<G4double>& tmax) const;
+
+  G4bool CheckHeader(std::ifstream&, const G4Material*, 
+                     const std::vector<G4double>& tmax) const;
+
+  G4bool RetrieveTables(const G4String& fname, const G4Material*, 
+                        const std::vector<G4double>& tmax,
+                        G4PhysicsTable* transferTable, 
+                        G4PhysicsTable* dedxTable,
+                        G4PhysicsLogVector* dedxMean);
+
+  void StoreTables(const G4String& fname, const G4Material*, 
+                   const std::vector<G4double>& tmax,
+                   const G4PhysicsTable* transferTable, 
+                   const G4PhysicsTable* dedxTable,
+                   const G4PhysicsLogVector* dedxMean) const;
+
   // hide assignment operator 
   G4PAIModelData & operator=(const  G4PAIModelData &right) = delete;
   G4PAIModelData(const  G4PAIModelData&) = delete;
 
   G4int                fTotBin;
+  G4int                fVerbose;
   G4double             fLowestKineticEnergy;
   G4double             fHighestKineticEnergy;
 
@@ -112,6 +162,10 @@ private:
   std::vector<G4PhysicsTable*>      fPAIxscBank;
   std::vector<G4PhysicsTable*>      fPAIdEdxBank;
   std::vector<G4PhysicsLogVector*>  fdEdxTable;
+
+  // material of each entry of the banks, couples with the same
+  // material share tables because they do not depend on cuts
+  std::vector<const G4Material*>    fMaterials;
 };
 
 #endif
@@ -35,10 +35,13 @@
 // Creation date: 16.08.2013
 //
 // Modifications:
+// 19.10.26 Tables of the same material are shared between couples, 
+//          parallel computation of vectors and binary file cache
 //
 
 #include "G4PAIModelData.hh"
 #include "G4PAIModel.hh"
+#include "G4EmParameters.hh"
 
 #include "G4SystemOfUnits.hh"
 #include "G4PhysicalConstants.hh"
@@ -50,6 +53,8 @@
 #include "G4SandiaTable.hh"
 #include "Randomize.hh"
 #include "G4Poisson.hh"
+#include <fstream>
+#include <cctype>
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -61,6 +66,7 @@ G4PAIModelData::G4PAIModelData(G4double tmin, G4double tmax, G4int ver)
   const G4double lowestTkin = 50*keV;
   const G4double highestTkin = 10*TeV;
 
+  fVerbose = ver;
   fPAIySection.SetVerbose(ver);
 
   fLowestKineticEnergy  = std::max(tmin, lowestTkin);
@@ -92,6 +98,12 @@ G4PAIModelData::~G4PAIModelData()
   size_t n = fPAIxscBank.size();
   if(0 < n) {
     for(size_t i=0; i<n; ++i) {
+      // shared tables are deleted once
+      G4bool first = true;
+      for(size_t j=0; j<i; ++j) {
+        if(fMaterials[j] == fMaterials[i]) { first = false; break; }
+      }
+      if(!first) { continue; }
       if(fPAIxscBank[i]) {
         fPAIxscBank[i]->clearAndDestroy();
 	delete fPAIxscBank[i];
@@ -112,38 +124,94 @@ void G4PAIModelData::Initialise(const G4MaterialCutsCouple* couple,
                                 G4PAIModel* model)
 {
   const G4Material* mat = couple->GetMaterial();     
+
+  // tables do not depend on cuts
+  size_t nmat = fMaterials.size();
+  for(size_t i=0; i<nmat; ++i) {
+    if(mat == fMaterials[i]) {
+      fMaterials.push_back(mat);
+      fPAIxscBank.push_back(fPAIxscBank[i]);
+      fPAIdEdxBank.push_back(fPAIdEdxBank[i]);
+      fdEdxTable.push_back(fdEdxTable[i]);
+      return;
+    }
+  }
+
   fSandia.Initialize(const_cast<G4Material*>(mat));
 
+  // low energy Sandia interval
+  G4double Tmin = fSandia.GetSandiaMatTablePAI(0,0); 
+
+  // energy safety
+  static const G4double deltaLow = 100.*eV; 
+
+  std::vector<G4double> tmax(fTotBin+1);
+  for (G4int i = 0; i <= fTotBin; ++i) {
+    G4double Tmax = model->ComputeMaxEnergy(fParticleEnergyVector->Energy(i));
+    if (Tmax < Tmin + deltaLow ) { Tmax = Tmin + deltaLow; }
+    tmax[i] = Tmax;
+  }
+
   G4PhysicsTable* PAItransferTable = new G4PhysicsTable(fTotBin+1);
   G4PhysicsTable* PAIdEdxTable = new G4PhysicsTable(fTotBin+1);
   G4PhysicsLogVector* dEdxMeanVector =
     new G4PhysicsLogVector(fLowestKineticEnergy,
 			   fHighestKineticEnergy,
 			   fTotBin);
-  // low energy Sandia interval
-  G4double Tmin = fSandia.GetSandiaMatTablePAI(0,0); 
 
-  // energy safety
-  static const G4double deltaLow = 100.*eV; 
+  G4String fname = "";
+  if(G4EmParameters::Instance()->DirectoryPAI().size() > 0) { 
+    fname = FileName(mat, model); 
+  }
+  G4bool done = false;
+  if(fname.size() > 0) {
+    done = RetrieveTables(fname, mat, tmax, PAItransferTable, 
+                          PAIdEdxTable, dEdxMeanVector);
+  }
+  if(!done) {
+    BuildTables(mat, tmax, PAItransferTable, PAIdEdxTable, dEdxMeanVector);
+    if(fname.size() > 0) {
+      StoreTables(fname, mat, tmax, PAItransferTable, 
+                  PAIdEdxTable, dEdxMeanVector);
+    }
+  }
+  fMaterials.push_back(mat);
+  fPAIxscBank.push_back(PAItransferTable);
+  fPAIdEdxBank.push_back(PAIdEdxTable);
+  //G4cout << "dEdxMeanVector: " << G4endl;
+  //G4cout << *dEdxMeanVector << G4endl;
+  /*
+  dEdxMeanVector->SetSpline(true);
+  dEdxMeanVector->FillSecondDerivatives();
+  */
+  fdEdxTable.push_back(dEdxMeanVector);
+}
 
-  for (G4int i = 0; i <= fTotBin; ++i) {
+//////////////////////////////////////////////////////////////////////////////
+
+G4ThreadFunReturnType G4PAIModelData::ComputeVectors(G4ThreadFunArgType arg)
+{
+  G4PAIModelDataTask* task = static_cast<G4PAIModelDataTask*>(arg);
+  G4PAIySection* sec = task->section;
+  size_t nbin = task->energy->size();
+
+  // each energy node is handled by exactly one thread, so the result 
+  // does not depend on the number of threads
+  for (size_t i = task->first; i < nbin; i += task->stride) {
 
-    G4double kinEnergy = fParticleEnergyVector->Energy(i);
-    G4double Tmax = model->ComputeMaxEnergy(kinEnergy);
+    G4double kinEnergy = (*(task->energy))[i];
     G4double tau = kinEnergy/proton_mass_c2;
     G4double bg2 = tau*( tau + 2. );
 
-    if (Tmax < Tmin + deltaLow ) { Tmax = Tmin + deltaLow; }
-
-    fPAIySection.Initialize(mat, Tmax, bg2, &fSandia);
+    sec->Initialize(task->material, (*(task->tmax))[i], bg2, task->sandia);
     
     //G4cout << i << ". TransferMax(keV)= "<< Tmax/keV  
     //	   << "  E(MeV)= " << kinEnergy/MeV << G4endl;
     
-    G4int n = fPAIySection.GetSplineSize();
+    G4int n = sec->GetSplineSize();
     G4int kmin = 0;
     for(G4int k = 0; k < n; ++k) {
-      if(fPAIySection.GetIntegralPAIySection(k+1) <= 0.0) { 
+      if(sec->GetIntegralPAIySection(k+1) <= 0.0) { 
 	kmin = k;
       } else {
 	break;
@@ -158,48 +226,246 @@ void G4PAIModelData::Initialise(const G4MaterialCutsCouple* couple,
     G4double tr = 0.0;
     for(G4int k = kmin; k < n; ++k)
     {
-      G4double t  = fPAIySection.GetSplineEnergy(k+1);
-      tr = fPAIySection.GetIntegralPAIySection(k+1);
+      G4double t  = sec->GetSplineEnergy(k+1);
+      tr = sec->GetIntegralPAIySection(k+1);
       //if(tr >= tr0) { tr0 = tr; }
       //else { G4cout << "G4PAIModelData::Initialise Warning: Ekin(MeV)= "
       //		    << t/MeV << " IntegralTransfer= " << tr 
       //		    << " < " << tr0 << G4endl; }
       transferVector->PutValue(k, t, t*tr);
-      dEdxVector->PutValue(k, t, fPAIySection.GetIntegralPAIdEdx(k+1));
+      dEdxVector->PutValue(k, t, sec->GetIntegralPAIdEdx(k+1));
     }
     //G4cout << "TransferVector:" << G4endl;
     //G4cout << *transferVector << G4endl;
     //G4cout << "DEDXVector:" << G4endl;
     //G4cout << *dEdxVector << G4endl;
 
-    G4double ionloss = fPAIySection.GetMeanEnergyLoss();//  total <dE/dx>
+    G4double ionloss = sec->GetMeanEnergyLoss();//  total <dE/dx>
 
     if(ionloss < 0.0) ionloss = 0.0; 
 
-    dEdxMeanVector->PutValue(i,ionloss);
+    (*(task->transfer))[i] = transferVector;
+    (*(task->dedx))[i] = dEdxVector;
+    (*(task->ionloss))[i] = ionloss;
+  }
+  return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void G4PAIModelData::BuildTables(const G4Material* mat, 
+                                 const std::vector<G4double>& tmax,
+                                 G4PhysicsTable* PAItransferTable, 
+                                 G4PhysicsTable* PAIdEdxTable,
+                                 G4PhysicsLogVector* dEdxMeanVector)
+{
+  size_t nbin = fTotBin + 1;
+  std::vector<G4double> energy(nbin);
+  for (size_t i = 0; i < nbin; ++i) { 
+    energy[i] = fParticleEnergyVector->Energy(i); 
+  }
+  std::vector<G4PhysicsFreeVector*> transfer(nbin, nullptr);
+  std::vector<G4PhysicsFreeVector*> dedx(nbin, nullptr);
+  std::vector<G4double> ionloss(nbin, 0.0);
+
+  size_t nthreads = 1;
+#ifdef G4MULTITHREADED
+  nthreads = std::min((size_t)G4EmParameters::Instance()
+                      ->NumberOfThreadsForTables(), nbin);
+  if(0 == nthreads) { nthreads = 1; }
+#endif
+  // the first task uses the section of this class
+  std::vector<G4PAIySection*> sections(nthreads, &fPAIySection);
+  std::vector<G4PAIModelDataTask> tasks(nthreads);
+  for(size_t t=0; t<nthreads; ++t) {
+    if(0 < t) { 
+      sections[t] = new G4PAIySection(); 
+      sections[t]->SetVerbose(fVerbose);
+    }
+    G4PAIModelDataTask& task = tasks[t];
+    task.section  = sections[t];
+    task.sandia   = &fSandia;
+    task.material = mat;
+    task.energy   = &energy;
+    task.tmax     = &tmax;
+    task.transfer = &transfer;
+    task.dedx     = &dedx;
+    task.ionloss  = &ionloss;
+    task.first    = t;
+    task.stride   = nthreads;
+  }
+#ifdef G4MULTITHREADED
+  if(1 < nthreads) {
+    std::vector<G4Thread> threads(nthreads - 1);
+    for(size_t t=1; t<nthreads; ++t) {
+      G4THREADCREATE(&threads[t-1], ComputeVectors, &tasks[t]);
+    }
+    ComputeVectors(&tasks[0]);
+    for(size_t t=1; t<nthreads; ++t) { G4THREADJOIN(threads[t-1]); }
+  } else {
+    ComputeVectors(&tasks[0]);
+  }
+#else
+  ComputeVectors(&tasks[0]);
+#endif
+  for(size_t t=1; t<nthreads; ++t) { delete sections[t]; }
 
-    PAItransferTable->insertAt(i,transferVector);
-    PAIdEdxTable->insertAt(i,dEdxVector);
+  for (size_t i = 0; i < nbin; ++i) { 
+    dEdxMeanVector->PutValue(i, ionloss[i]);
+    PAItransferTable->insertAt(i, transfer[i]);
+    PAIdEdxTable->insertAt(i, dedx[i]);
 
     //transferVector->SetSpline(true);
     //transferVector->FillSecondDerivatives();
     //dEdxVector->SetSpline(true);
     //dEdxVector->FillSecondDerivatives();
+  }
+}
 
-  } // end of Tkin loop`
-  fPAIxscBank.push_back(PAItransferTable);
-  fPAIdEdxBank.push_back(PAIdEdxTable);
-  //G4cout << "dEdxMeanVector: " << G4endl;
-  //G4cout << *dEdxMeanVector << G4endl;
-  /*
-  dEdxMeanVector->SetSpline(true);
-  dEdxMeanVector->FillSecondDerivatives();
-  */
-  fdEdxTable.push_back(dEdxMeanVector);
+//////////////////////////////////////////////////////////////////////////////
+
+G4String G4PAIModelData::FileName(const G4Material* mat, 
+                                  const G4PAIModel* model) const
+{
+  G4String name = "PAI_" + mat->GetName() + "_" 
+    + model->GetParticle()->GetParticleName();
+  // only safe characters in the file name
+  for(size_t i=0; i<name.size(); ++i) {
+    char c = name[i];
+    if(!std::isalnum(c) && c != '_' && c != '-' && c != '+') { 
+      name[i] = '_'; 
+    }
+  }
+  return G4EmParameters::Instance()->DirectoryPAI() + "/" + name + ".dat";
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+void G4PAIModelData::WriteHeader(std::ofstream& out, const G4Material* mat,
+                                 const std::vector<G4double>& tmax) const
+{
+  G4int nbin = fTotBin;
+  G4int nelm = mat->GetNumberOfElements();
+  G4double den = mat->GetDensity();
+  G4double eden = mat->GetElectronDensity();
+  out.write((const char*)(&nbin), sizeof nbin);
+  out.write((const char*)(&fLowestKineticEnergy), sizeof(G4double));
+  out.write((const char*)(&fHighestKineticEnergy), sizeof(G4double));
+  out.write((const char*)(&den), sizeof den);
+  out.write((const char*)(&eden), sizeof eden);
+  out.write((const char*)(&nelm), sizeof nelm);
+  const G4double* atoms = mat->GetVecNbOfAtomsPerVolume();
+  for(G4int i=0; i<nelm; ++i) {
+    G4double z = (*(mat->GetElementVector()))[i]->GetZ();
+    out.write((const char*)(&z), sizeof z);
+    out.write((const char*)(&atoms[i]), sizeof(G4double));
+  }
+  out.write((const char*)(&tmax[0]), tmax.size()*sizeof(G4double));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+G4bool G4PAIModelData::CheckHeader(std::ifstream& in, const G4Material* mat,
+                                   const std::vector<G4double>& tmax) const
+{
+  // the header is written by the same code, so values should coincide
+  // exactly with the values of the current run
+  G4int nbin = 0;
+  in.read((char*)(&nbin), sizeof nbin);
+  if(in.fail() || nbin != fTotBin) { return false; }
+  G4double x[4];
+  in.read((char*)x, 4*sizeof(G4double));
+  if(in.fail() || x[0] != fLowestKineticEnergy 
+     || x[1] != fHighestKineticEnergy || x[2] != mat->GetDensity() 
+     || x[3] != mat->GetElectronDensity()) { return false; }
+  G4int nelm = 0;
+  in.read((char*)(&nelm), sizeof nelm);
+  if(in.fail() || nelm != (G4int)mat->GetNumberOfElements()) { return false; }
+  const G4double* atoms = mat->GetVecNbOfAtomsPerVolume();
+  for(G4int i=0; i<nelm; ++i) {
+    in.read((char*)x, 2*sizeof(G4double));
+    if(in.fail() || x[0] != (*(mat->GetElementVector()))[i]->GetZ()
+       || x[1] != atoms[i]) { return false; }
+  }
+  std::vector<G4double> t(tmax.size(), 0.0);
+  in.read((char*)(&t[0]), t.size()*sizeof(G4double));
+  return (!in.fail() && t == tmax);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+G4bool G4PAIModelData::RetrieveTables(const G4String& fname, 
+                                      const G4Material* mat, 
+                                      const std::vector<G4double>& tmax,
+                                      G4PhysicsTable* PAItransferTable, 
+                                      G4PhysicsTable* PAIdEdxTable,
+                                      G4PhysicsLogVector* dEdxMeanVector)
+{
+  std::ifstream in(fname, std::ios::in | std::ios::binary);
+  if(!in || !CheckHeader(in, mat, tmax)) { return false; }
+
+  std::vector<G4PhysicsFreeVector*> v(2*(fTotBin+1), nullptr);
+  G4bool ok = true;
+  for(size_t i=0; i<v.size(); ++i) {
+    v[i] = new G4PhysicsFreeVector();
+    if(!v[i]->Retrieve(in, false)) { ok = false; break; }
+  }
+  G4PhysicsLogVector mean;
+  if(ok) { ok = mean.Retrieve(in, false); }
+  if(ok) { ok = (mean.GetVectorLength() == (size_t)(fTotBin+1)); }
+  if(!ok) {
+    for(size_t i=0; i<v.size(); ++i) { delete v[i]; }
+    if(0 < fVerbose) {
+      G4cout << "### G4PAIModelData: file " << fname 
+             << " is corrupted, tables are recomputed" << G4endl;
+    }
+    return false;
+  }
+  for(G4int i=0; i<=fTotBin; ++i) {
+    PAItransferTable->insertAt(i, v[2*i]);
+    PAIdEdxTable->insertAt(i, v[2*i+1]);
+    dEdxMeanVector->PutValue(i, mean[i]);
+  }
+  if(0 < fVerbose) {
+    G4cout << "### G4PAIModelData: tables for " << mat->GetName()
+           << " are retrieved from " << fname << G4endl;
+  }
+  return true;
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
+void G4PAIModelData::StoreTables(const G4String& fname, 
+                                 const G4Material* mat, 
+                                 const std::vector<G4double>& tmax,
+                                 const G4PhysicsTable* PAItransferTable, 
+                                 const G4PhysicsTable* PAIdEdxTable,
+                                 const G4PhysicsLogVector* dEdxMeanVector) 
+  const
+{
+  std::ofstream out(fname, std::ios::out | std::ios::binary);
+  G4bool ok = out.good();
+  if(ok) {
+    WriteHeader(out, mat, tmax);
+    for(G4int i=0; i<=fTotBin && ok; ++i) {
+      ok = (*PAItransferTable)[i]->Store(out, false) 
+        && (*PAIdEdxTable)[i]->Store(out, false);
+    }
+    if(ok) { ok = dEdxMeanVector->Store(out, false); }
+    out.close();
+  }
+  if(!ok) {
+    G4ExceptionDescription ed;
+    ed << "Cannot write PAI tables to the file " << fname;
+    G4Exception("G4PAIModelData::StoreTables()","em0003",JustWarning,ed);
+  } else if(0 < fVerbose) {
+    G4cout << "### G4PAIModelData: tables for " << mat->GetName()
+           << " are stored in " << fname << G4endl;
+  }
+}
+
+//////
+
 G4double G4PAIModelData::DEDXPerVolume(G4int coupleIndex, G4double scaledTkin,
 			 G4double cut) const
 {
@@ -29,6 +29,7 @@
 //
 // History:
 //
+// 19.10.26 element selectors are built on master and shared
 // 14.10.12 V.Grichine, update of xsc and angular distribution
 // 25.05.2011   first implementation
 
@@ -93,7 +94,7 @@ void G4XrayRayleighModel::Initialise(const G4ParticleDefinition* particle,
     G4cout << "Calling G4XrayRayleighModel::Initialise()" << G4endl;
   }
 
-  InitialiseElementSelectors(particle,cuts);
+  if(IsMaster()) { InitialiseElementSelectors(particle,cuts); }
 
 
   if(isInitialised) return; 
@@ -102,6 +103,14 @@ void G4XrayRayleighModel::Initialise(const G4ParticleDefinition* particle,
 
 }
 
+/////////////////////////////////////////////////////////////////////////////////////
+
+void G4XrayRayleighModel::InitialiseLocal(const G4ParticleDefinition*,
+                                          G4VEmModel* masterModel)
+{
+  SetElementSelectors(masterModel->GetElementSelectors());
+}
+
 /////////////////////////////////////////////////////////////////////////////////
 
 G4double G4XrayRayleighModel::ComputeCrossSectionPerAtom(
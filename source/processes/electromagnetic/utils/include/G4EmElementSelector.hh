@@ -37,7 +37,8 @@
 // Creation date: 29.05.2008
 //
 // Modifications:
-//
+// 19.10.2026 Cumulative probabilities of all elements are packed in one
+//            array, one row per energy node
 //
 // Class Description:
 //
@@ -55,6 +56,7 @@
 #include "G4Element.hh"
 #include "G4ElementVector.hh"
 #include "G4PhysicsLogVector.hh"
+#include "G4Log.hh"
 #include "Randomize.hh"
 #include <vector>
 
@@ -81,6 +83,9 @@ public:
 
 private:
 
+  // index of the low node of the energy bin and the weight of this node
+  inline size_t FindBin(G4double e, G4double& w) const;
+
   //  hide assignment operator
   G4EmElementSelector & operator=(const  G4EmElementSelector &right) = delete;
   G4EmElementSelector(const  G4EmElementSelector&) = delete;
@@ -95,27 +100,57 @@ private:
   G4double cutEnergy;
   G4double lowEnergy;
   G4double highEnergy;
+  G4double dBin;
+  G4double baseBin;
+
+  // energy nodes of the log grid
+  std::vector<G4double> energy;
 
-  std::vector<G4PhysicsLogVector*> xSections;
+  // cumulative probabilities of the first nElmMinusOne elements,
+  // element i at the node j is stored at j*nElmMinusOne + i
+  std::vector<G4double> probability;
   
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
+inline size_t G4EmElementSelector::FindBin(G4double e, G4double& w) const
+{
+  w = 1.0;
+  if(e <= energy[0]) { return 0; }
+  if(e >= energy[nbins]) { return nbins; }
+  size_t j = size_t(G4Log(e)/dBin - baseBin);
+  if(j > 0 && e < energy[j]) { --j; }
+  else if(e > energy[j+1]) { ++j; }
+  j = std::min(j, size_t(nbins - 1));
+  w = (energy[j+1] - e)/(energy[j+1] - energy[j]);
+  return j;
+}
+
 inline const G4Element* G4EmElementSelector::SelectRandomAtom(G4double e) const
 {
-  const G4Element* element = (*theElementVector)[nElmMinusOne];
+  G4int idx = nElmMinusOne;
   if (nElmMinusOne > 0) {
     G4double x = G4UniformRand();
-    for(G4int i=0; i<nElmMinusOne; ++i) {
-      if (x <= (xSections[i])->Value(e)) {
-        element = (*theElementVector)[i];
-        break;
+    G4double w0;
+    size_t j = FindBin(e, w0);
+    const G4double* p0 = &probability[j*nElmMinusOne];
+    // interpolated cumulative probabilities do not decrease with 
+    // the element index, so the selected element is given by the 
+    // number of probabilities below x; the loop has no branches
+    idx = 0;
+    if(1.0 == w0) {
+      for(G4int i=0; i<nElmMinusOne; ++i) { idx += (p0[i] < x); }
+    } else {
+      const G4double* p1 = p0 + nElmMinusOne;
+      G4double w1 = 1.0 - w0;
+      for(G4int i=0; i<nElmMinusOne; ++i) { 
+        idx += (w0*p0[i] + w1*p1[i] < x); 
       }
     }
   }
-  return element;
+  return (*theElementVector)[idx];
 }
 
 inline const G4Material* G4EmElementSelector::GetMaterial() const
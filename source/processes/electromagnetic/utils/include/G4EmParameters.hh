@@ -139,9 +139,17 @@ public:
   void SetIntegral(G4bool val);
   G4bool Integral() const;
 
+  // use per bin majorant of lambda for integral approach
+  void SetLambdaMajorant(G4bool val);
+  G4bool LambdaMajorant() const;
+
   void SetBirksActive(G4bool val);
   G4bool BirksActive() const;
 
+  // keep EM tables in single precision
+  void SetCompactTables(G4bool val);
+  G4bool CompactTables() const;
+
   void SetEmSaturation(G4EmSaturation*);
   G4EmSaturation* GetEmSaturation();
 
@@ -208,6 +216,10 @@ public:
   void SetWorkerVerbose(G4int val);
   G4int WorkerVerbose() const;
 
+  // number of threads used on master for building of tables
+  void SetNumberOfThreadsForTables(G4int val);
+  G4int NumberOfThreadsForTables() const;
+
   void SetMscStepLimitType(G4MscStepLimitType val);
   G4MscStepLimitType MscStepLimitType() const;
 
@@ -224,6 +236,11 @@ public:
   void SetPIXEElectronCrossSectionModel(const G4String&);
   const G4String& PIXEElectronCrossSectionModel();
 
+  // directory for binary files of PAI model tables, 
+  // if empty the tables are not stored
+  void SetDirectoryPAI(const G4String&);
+  const G4String& DirectoryPAI() const;
+
   // parameters per region or per process 
   void AddPAIModel(const G4String& particle,
                    const G4String& region,
@@ -308,7 +325,9 @@ private:
   G4bool useAngGeneratorForIonisation;
   G4bool useMottCorrection;
   G4bool integral;
+  G4bool lambdaMajorant;
   G4bool birks;
+  G4bool compactTables;
 
   G4double minSubRange;
   G4double minKinEnergy;
@@ -334,6 +353,7 @@ private:
   G4int nbinsPerDecade;
   G4int verbose;
   G4int workerVerbose;
+  G4int nThreadsForTables;
 
   G4MscStepLimitType mscStepLimit;
   G4MscStepLimitType mscStepLimitMuHad;
@@ -341,6 +361,7 @@ private:
 
   G4String namePIXE;
   G4String nameElectronPIXE;
+  G4String dirPAI;
 
   std::vector<G4String>  m_particlesPAI;
   std::vector<G4String>  m_regnamesPAI;
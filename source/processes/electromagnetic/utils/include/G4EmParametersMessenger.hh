@@ -99,8 +99,10 @@ private:
   G4UIcmdWithABool*          catCmd;
   G4UIcmdWithABool*          delCmd;
   G4UIcmdWithABool*          IntegCmd;
+  G4UIcmdWithABool*          majCmd;
   G4UIcmdWithABool*          mottCmd;
   G4UIcmdWithABool*          birksCmd;
+  G4UIcmdWithABool*          compCmd;
 
   G4UIcmdWithADouble*        minSubSecCmd;
   G4UIcmdWithADoubleAndUnit* minEnCmd;
@@ -124,12 +126,14 @@ private:
   G4UIcmdWithAnInteger*      verCmd;
   G4UIcmdWithAnInteger*      ver1Cmd;
   G4UIcmdWithAnInteger*      ver2Cmd;
+  G4UIcmdWithAnInteger*      thrCmd;
 
   G4UIcmdWithAString*        mscCmd;
   G4UIcmdWithAString*        msc1Cmd;
 
   G4UIcmdWithAString*        pixeXsCmd;
   G4UIcmdWithAString*        pixeeXsCmd;
+  G4UIcmdWithAString*        dirPAICmd;
 
   G4UIcommand*               paiCmd;
   G4UIcmdWithAString*        meCmd;
@@ -40,6 +40,9 @@
 // Modifications: 
 // 08-11-04 Migration to new interface of Store/Retrieve tables (V.Ivanchenko)
 // 17-07-08 Added splineFlag (V.Ivanchenko)
+// 19-10-26 dE/dx sum, range and inverse range vectors of different couples
+//          may be built in parallel on master
+// 19-10-26 Added MaxInInterval()
 //
 // Class Description: 
 //
@@ -54,10 +57,35 @@
 #include <vector>
 #include "globals.hh"
 #include "G4PhysicsTable.hh"
+#include "G4Threading.hh"
 
 class G4VEmModel;
 class G4ParticleDefinition;
 class G4EmParameters;
+class G4PhysicsVector;
+class G4Timer;
+class G4LossTableBuilder;
+
+enum G4LossTableBuilderType 
+{
+  fBuildDEDXSum = 0,
+  fBuildRange,
+  fBuildInverseRange
+};
+
+// input and output of one thread building vectors of a table 
+struct G4LossTableBuilderTask
+{
+  G4LossTableBuilder* builder;
+  G4LossTableBuilderType type;
+  const G4PhysicsTable* input;
+  const std::vector<G4PhysicsTable*>* list;
+  std::vector<G4PhysicsVector*>* result;
+  size_t nCouples;
+  size_t first;
+  size_t stride;
+  G4bool isIonisation;
+};
 
 class G4LossTableBuilder
 {
@@ -92,6 +120,26 @@ public:
   // initialise base materials
   void InitialiseBaseMaterials(G4PhysicsTable* table);
 
+  // convert vectors of the table to single precision if this
+  // is enabled via G4EmParameters, accuracy is reported
+  void CompactTable(G4PhysicsTable* table, const G4String& name);
+
+  // majorant of the cross section for each bin of lambda vectors
+  // of base couples: for the bin [E_j, E_j+1] it is the maximum of 
+  // lambda in the interval [E_j*factor, E_j+1], the offset of the 
+  // first bin of a couple is stored in the offset vector;
+  // the maximum is taken on the interpolated lambda (linear or spline)
+  // including the overshoot of the spline between nodes, so that the
+  // majorant bounds the values used in tracking up to a small margin
+  void BuildLambdaMajorant(const G4PhysicsTable* table, G4double factor,
+                           std::vector<G4double>& majorant,
+                           std::vector<size_t>& offset);
+
+  // maximum of the interpolated vector (linear or spline) in the energy
+  // interval [e1, e2], up to rounding; outside of the vector the values
+  // at the edges are used as in G4PhysicsVector::Value()
+  static G4double MaxInInterval(const G4PhysicsVector*, 
+                                G4double e1, G4double e2);
 
   // access methods
   inline const std::vector<G4int>* GetCoupleIndexes();
@@ -108,6 +156,30 @@ private:
 
   void InitialiseCouples();
 
+  // fill result vector for all couples, the work is shared between
+  // NumberOfThreadsForTables() threads in MT mode
+  void BuildVectors(G4LossTableBuilderType type, size_t nCouples,
+                    const G4PhysicsTable* input,
+                    const std::vector<G4PhysicsTable*>* list,
+                    G4bool isIonisation,
+                    std::vector<G4PhysicsVector*>& result);
+
+  static G4ThreadFunReturnType BuildVectorsThread(G4ThreadFunArgType arg);
+
+  G4PhysicsVector* BuildVector(const G4LossTableBuilderTask*, size_t idx);
+
+  G4PhysicsVector* BuildDEDXVector(size_t idx,
+                                   const std::vector<G4PhysicsTable*>&);
+
+  G4PhysicsVector* BuildRangeVector(G4PhysicsVector* dedx);
+
+  G4PhysicsVector* BuildInverseRangeVector(const G4PhysicsVector* range);
+
+  // maximum of the interpolated vector inside the bin [E_idx, E_idx+1]
+  static G4double MaxInBin(const G4PhysicsVector*, size_t idx);
+
+  void PrintTiming(const G4String& name, size_t nCouples, const G4Timer&);
+
   G4LossTableBuilder & operator=(const  G4LossTableBuilder &right) = delete;
   G4LossTableBuilder(const  G4LossTableBuilder&) = delete;
 
@@ -55,6 +55,9 @@
 // 27-10-07 Virtual functions moved to source (V.Ivanchenko)
 // 15-07-08 Reorder class members for further multi-thread development (VI)
 // 17-02-10 Added pointer currentParticle (VI)
+// 19-10-26 Added lambda majorant for integral approach and counters
+// 19-10-26 Added AllowFusedStepLimit()
+// 19-10-26 Added GetMaxLambda()
 //
 // Class Description:
 //
@@ -179,6 +182,18 @@ public:
   inline G4double GetLambda(G4double& kinEnergy, 
                             const G4MaterialCutsCouple* couple);
 
+  // Upper bound of GetLambda() in the energy interval [e1, e2] from the
+  // lambda tables, including the overshoot of the spline interpolation;
+  // it is negative if a part of the interval is not covered by tables
+  G4double GetMaxLambda(G4double e1, G4double e2,
+                        const G4MaterialCutsCouple* couple);
+
+  // True if the step limit is the mean free path given by GetLambda()
+  // at the pre-step point, so that the stepping manager may sample one 
+  // step limit for several such processes and select the process at 
+  // the interaction point (no integral approach, no biasing)
+  virtual G4bool AllowFusedStepLimit() const;
+
   //------------------------------------------------------------------------
   // Specific methods to build and access Physics Tables
   //------------------------------------------------------------------------
@@ -357,9 +372,12 @@ private:
   G4PhysicsTable*              theLambdaTablePrim;
   std::vector<G4double>        theEnergyOfCrossSectionMax;
   std::vector<G4double>        theCrossSectionMax;
+  std::vector<G4double>        theLambdaMajorant;
+  std::vector<size_t>          theMajorantOffset;
 
   size_t                       idxLambda;
   size_t                       idxLambdaPrim;
+  size_t                       idxMajorant;
 
   const std::vector<G4double>* theCuts;
   const std::vector<G4double>* theCutsGamma;
@@ -377,6 +395,8 @@ private:
   G4double                     biasFactor;
 
   G4bool                       integral;
+  G4bool                       useMajorant;
+  G4bool                       allModelsActive;
   G4bool                       applyCuts;
   G4bool                       startFromNull;
   G4bool                       splineFlag;
@@ -419,6 +439,11 @@ private:
   G4int                        fluoID;  
   G4int                        augerID;  
   G4int                        biasID;  
+
+  // counters of the integral approach
+  G4long                       nLambdaCalls;
+  G4long                       nFictitious;
+  G4long                       nInteractions;
 };
 
 // ======== Run time inline methods ================
@@ -455,7 +480,7 @@ inline void G4VEmProcess::DefineMaterial(const G4MaterialCutsCouple* couple)
     fFactor = biasFactor*(*theDensityFactor)[currentCoupleIndex];
     if(!baseMaterial) { baseMaterial = currentMaterial; }
     mfpKinEnergy = DBL_MAX;
-    idxLambda = idxLambdaPrim = 0;
+    idxLambda = idxLambdaPrim = idxMajorant = 0;
   }
 }
 
@@ -538,6 +563,18 @@ G4VEmProcess::RecalculateLambda(G4double e, const G4MaterialCutsCouple* couple)
 
 inline void G4VEmProcess::ComputeIntegralLambda(G4double e)
 {
+  ++nLambdaCalls;
+  // majorant is valid down to the low edge of the current bin 
+  // multiplied by lambdaFactor
+  if(0 < theMajorantOffset.size() && e < minKinEnergyPrim) {
+    const G4PhysicsVector* pv = (*theLambdaTable)[basedCoupleIndex];
+    idxMajorant = pv->FindBin(e, idxMajorant);
+    preStepLambda = fFactor*
+      theLambdaMajorant[theMajorantOffset[basedCoupleIndex] + idxMajorant];
+    mfpKinEnergy = (0 == idxMajorant) 
+      ? 0.0 : pv->Energy(idxMajorant)*lambdaFactor;
+    return;
+  }
   mfpKinEnergy  = theEnergyOfCrossSectionMax[currentCoupleIndex];
   if (e <= mfpKinEnergy) {
     preStepLambda = GetCurrentLambda(e);
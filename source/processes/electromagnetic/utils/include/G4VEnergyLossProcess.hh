@@ -79,6 +79,7 @@
 //          PostStepGetPhysicalInteractionLength (V.Ivanchenko)
 // 27-10-07 Virtual functions moved to source (V.Ivanchenko)
 // 15-07-08 Reorder class members for further multi-thread development (VI)
+// 19-10-26 Added lambda majorant for integral approach and counters
 //
 // Class Description:
 //
@@ -520,11 +521,14 @@ private:
   size_t                      idxInverseRange;
   size_t                      idxLambda;
   size_t                      idxSubLambda;
+  size_t                      idxMajorant;
 
   std::vector<G4double>       theDEDXAtMaxEnergy;
   std::vector<G4double>       theRangeAtMaxEnergy;
   std::vector<G4double>       theEnergyOfCrossSectionMax;
   std::vector<G4double>       theCrossSectionMax;
+  std::vector<G4double>       theLambdaMajorant;
+  std::vector<size_t>         theMajorantOffset;
 
   const std::vector<G4double>* theDensityFactor;
   const std::vector<G4int>*    theDensityIdx;
@@ -552,6 +556,7 @@ private:
   G4bool   rndmStepFlag;
   G4bool   tablesAreBuilt;
   G4bool   integral;
+  G4bool   useMajorant;
   G4bool   isIon;
   G4bool   isIonisation;
   G4bool   useSubCutoff;
@@ -605,6 +610,11 @@ private:
   G4int    secID;  
   G4int    subsecID;  
   G4int    biasID;  
+
+  // counters of the integral approach
+  G4long   nLambdaCalls;
+  G4long   nFictitious;
+  G4long   nInteractions;
 };
 
 // ======== Run time inline methods ================
@@ -643,7 +653,7 @@ G4VEnergyLossProcess::DefineMaterial(const G4MaterialCutsCouple* couple)
     fFactor = chargeSqRatio*biasFactor*(*theDensityFactor)[currentCoupleIndex];
     reduceFactor = 1.0/(fFactor*massRatio);
     mfpKinEnergy = DBL_MAX;
-    idxLambda = idxSubLambda = 0;
+    idxLambda = idxSubLambda = idxMajorant = 0;
   }
 }
 
@@ -859,6 +869,18 @@ G4VEnergyLossProcess::GetLambda(G4double& kineticEnergy,
 
 inline void G4VEnergyLossProcess::ComputeLambdaForScaledEnergy(G4double e)
 {
+  ++nLambdaCalls;
+  // majorant is valid down to the low edge of the current bin 
+  // multiplied by lambdaFactor
+  if(0 < theMajorantOffset.size()) {
+    const G4PhysicsVector* pv = (*theLambdaTable)[basedCoupleIndex];
+    idxMajorant = pv->FindBin(e, idxMajorant);
+    preStepLambda = fFactor*
+      theLambdaMajorant[theMajorantOffset[basedCoupleIndex] + idxMajorant];
+    mfpKinEnergy = (0 == idxMajorant) 
+      ? 0.0 : pv->Energy(idxMajorant)*lambdaFactor;
+    return;
+  }
   mfpKinEnergy  = theEnergyOfCrossSectionMax[currentCoupleIndex];
   if (e <= mfpKinEnergy) {
     preStepLambda = GetLambdaForScaledEnergy(e);
@@ -37,6 +37,8 @@
 // Creation date: 29.05.2008
 //
 // Modifications:
+// 19.10.2026 Cumulative probabilities of all elements are packed in one
+//            array, one row per energy node
 //
 // Class Description:
 //
@@ -48,6 +50,7 @@
 #include "G4EmElementSelector.hh"
 #include "G4VEmModel.hh"
 #include "G4SystemOfUnits.hh"
+#include "G4Exp.hh"
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -59,20 +62,20 @@ G4EmElementSelector::G4EmElementSelector(G4VEmModel* mod,
                                          G4double emax,
                                          G4bool):
   model(mod), material(mat), nbins(bins), cutEnergy(-1.0), 
-  lowEnergy(emin), highEnergy(emax)
+  lowEnergy(emin), highEnergy(emax), dBin(0.0), baseBin(0.0)
 {
   G4int n = material->GetNumberOfElements();
   nElmMinusOne = n - 1;
   theElementVector = material->GetElementVector();
   if(nElmMinusOne > 0) {
-    xSections.reserve(n);
-    G4PhysicsLogVector* v0 = new G4PhysicsLogVector(lowEnergy,highEnergy,nbins);
-    xSections.push_back(v0);
-    v0->SetSpline(false);
-    for(G4int i=1; i<n; ++i) {
-      G4PhysicsLogVector* v = new G4PhysicsLogVector(*v0);
-      xSections.push_back(v);
-    }
+    // the same nodes as in G4PhysicsLogVector
+    dBin    = G4Log(highEnergy/lowEnergy)/(G4double)nbins;
+    baseBin = G4Log(lowEnergy)/dBin;
+    energy.resize(nbins+1);
+    energy[0] = lowEnergy;
+    for(G4int j=1; j<nbins; ++j) { energy[j] = G4Exp((baseBin+j)*dBin); }
+    energy[nbins] = highEnergy;
+    probability.resize((nbins+1)*nElmMinusOne, 0.0);
   }
   /*  
   G4cout << "G4EmElementSelector for " << mat->GetName() << " n= " << n
@@ -84,11 +87,7 @@ G4EmElementSelector::G4EmElementSelector(G4VEmModel* mod,
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 G4EmElementSelector::~G4EmElementSelector()
-{
-  if(nElmMinusOne > 0) {
-    for(G4int i=0; i<=nElmMinusOne; ++i) { delete xSections[i]; }
-  }
-}
+{}
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -106,9 +105,13 @@ void G4EmElementSelector::Initialise(const G4ParticleDefinition* part,
   const G4double* theAtomNumDensityVector = 
     material->GetVecNbOfAtomsPerVolume();
 
+  // cumulative cross sections of all elements for all nodes
+  G4int n = nElmMinusOne + 1;
+  std::vector<G4double> xsec((nbins+1)*n, 0.0);
+
   // loop over bins
   for(G4int j=0; j<=nbins; ++j) {
-    G4double e = (xSections[0])->Energy(j);
+    G4double e = energy[j];
     model->SetupForMaterial(part, material, e);
     cross = 0.0;
     //G4cout << "j= " << j << " e(MeV)= " << e/MeV << G4endl;
@@ -116,31 +119,28 @@ void G4EmElementSelector::Initialise(const G4ParticleDefinition* part,
       cross += theAtomNumDensityVector[i]*      
         model->ComputeCrossSectionPerAtom(part, (*theElementVector)[i], e, 
                                           cutEnergy, e);
-      xSections[i]->PutValue(j, cross);
+      xsec[j*n + i] = cross;
     }
   }
 
   // xSections start from null, so use probabilities from the next bin
-  if(0.0 == (*xSections[nElmMinusOne])[0]) {
-    for (G4int i=0; i<=nElmMinusOne; ++i) {
-      xSections[i]->PutValue(0, (*xSections[i])[1]);
-    }
+  if(0.0 == xsec[nElmMinusOne]) {
+    for (G4int i=0; i<=nElmMinusOne; ++i) { xsec[i] = xsec[n + i]; }
   }
   // xSections ends with null, so use probabilities from the previous bin
-  if(0.0 == (*xSections[nElmMinusOne])[nbins]) {
+  if(0.0 == xsec[nbins*n + nElmMinusOne]) {
     for (G4int i=0; i<=nElmMinusOne; ++i) {
-      xSections[i]->PutValue(nbins, (*xSections[i])[nbins-1]);
+      xsec[nbins*n + i] = xsec[(nbins-1)*n + i];
     }
   }
   // perform normalization
   for(G4int j=0; j<=nbins; ++j) {
-    cross = (*xSections[nElmMinusOne])[j];
-    // only for positive X-section 
-    if(cross > 0.0) {
-      for (G4int i=0; i<nElmMinusOne; ++i) {
-        G4double x = (*xSections[i])[j]/cross;
-        xSections[i]->PutValue(j, x);
-      }
+    cross = xsec[j*n + nElmMinusOne];
+    for (G4int i=0; i<nElmMinusOne; ++i) {
+      G4double x = xsec[j*n + i];
+      // only for positive X-section 
+      if(cross > 0.0) { x /= cross; }
+      probability[j*nElmMinusOne + i] = x;
     }
   }
   //G4cout << "======== G4EmElementSelector for the " << model->GetName() 
@@ -157,7 +157,10 @@ void G4EmElementSelector::Dump(const G4ParticleDefinition* part)
   if(0 < nElmMinusOne) {
     for(G4int i=0; i<nElmMinusOne; i++) {
       G4cout << "      " << (*theElementVector)[i]->GetName() << " : " << G4endl;
-      G4cout << *(xSections[i]) << G4endl;
+      for(G4int j=0; j<=nbins; ++j) {
+        G4cout << energy[j] << "   " 
+               << probability[j*nElmMinusOne + i] << G4endl;
+      }
     }
   }  
   G4cout << "Last Element in element vector " 
@@ -118,7 +118,9 @@ void G4EmParameters::Initialise()
   useAngGeneratorForIonisation = false;
   useMottCorrection = false;
   integral = true;
+  lambdaMajorant = false;
   birks = false;
+  compactTables = false;
 
   minSubRange = 1.0;
   minKinEnergy = 0.1*CLHEP::keV;
@@ -144,6 +146,7 @@ void G4EmParameters::Initialise()
   nbinsPerDecade = 7;
   verbose = 1;
   workerVerbose = 0;
+  nThreadsForTables = 1;
 
   mscStepLimit = fUseSafety;
   mscStepLimitMuHad = fMinimal;
@@ -151,6 +154,7 @@ void G4EmParameters::Initialise()
 
   namePIXE = "Empirical";
   nameElectronPIXE = "Livermore";
+  dirPAI = "";
 }
 
 void G4EmParameters::SetLossFluctuations(G4bool val)
@@ -354,6 +358,17 @@ G4bool G4EmParameters::Integral() const
   return integral;
 }
 
+void G4EmParameters::SetLambdaMajorant(G4bool val)
+{
+  if(IsLocked()) { return; }
+  lambdaMajorant = val;
+}
+
+G4bool G4EmParameters::LambdaMajorant() const
+{
+  return lambdaMajorant;
+}
+
 void G4EmParameters::SetBirksActive(G4bool val)
 {
   if(IsLocked()) { return; }
@@ -369,6 +384,17 @@ G4bool G4EmParameters::BirksActive() const
   return birks;
 }
 
+void G4EmParameters::SetCompactTables(G4bool val)
+{
+  if(IsLocked()) { return; }
+  compactTables = val;
+}
+
+G4bool G4EmParameters::CompactTables() const
+{
+  return compactTables;
+}
+
 void G4EmParameters::SetEmSaturation(G4EmSaturation* ptr)
 {
   if(emSaturation != ptr) {
@@ -744,6 +770,24 @@ G4int G4EmParameters::WorkerVerbose() const
   return workerVerbose;
 }
 
+void G4EmParameters::SetNumberOfThreadsForTables(G4int val)
+{
+  if(IsLocked()) { return; }
+  if(val >= 1 && val <= 256) {
+    nThreadsForTables = val;
+  } else {
+    G4ExceptionDescription ed;
+    ed << "Number of threads for building of tables is out of range: " 
+       << val << " is ignored"; 
+    PrintWarning(ed);
+  }
+}
+
+G4int G4EmParameters::NumberOfThreadsForTables() const 
+{
+  return nThreadsForTables;
+}
+
 void G4EmParameters::SetMscStepLimitType(G4MscStepLimitType val)
 {
   if(IsLocked()) { return; }
@@ -801,6 +845,17 @@ const G4String& G4EmParameters::PIXEElectronCrossSectionModel()
   return nameElectronPIXE;
 }
 
+void G4EmParameters::SetDirectoryPAI(const G4String& sss)
+{
+  if(IsLocked()) { return; }
+  dirPAI = sss;
+}
+
+const G4String& G4EmParameters::DirectoryPAI() const
+{
+  return dirPAI;
+}
+
 void G4EmParameters::PrintWarning(G4ExceptionDescription& ed) const
 {
   G4Exception("G4EmParameters", "em0044", JustWarning, ed);
@@ -1147,8 +1202,12 @@ std::ostream& G4EmParameters::StreamInfo(std::ostream& os) const
      <<useMottCorrection << "\n";
   os << "Use integral approach for tracking                 " 
      <<integral << "\n";
+  os << "Use lambda majorant for integral approach          " 
+     <<lambdaMajorant << "\n";
   os << "Use built-in Birks satuaration                     " 
      << birks << "\n";
+  os << "Use single precision EM tables                     " 
+     << compactTables << "\n";
 
   os << "Factor of cut reduction for sub-cutoff method      " <<minSubRange << "\n";
   os << "Min kinetic energy for tables                      " 
@@ -1184,6 +1243,7 @@ std::ostream& G4EmParameters::StreamInfo(std::ostream& os) const
   os << "Number of bins per decade of a table               " <<nbinsPerDecade << "\n";
   os << "Verbose level                                      " <<verbose << "\n";
   os << "Verbose level for worker thread                    " <<workerVerbose << "\n";
+  os << "Number of threads for building of tables           " <<nThreadsForTables << "\n";
 
   os << "Type of msc step limit algorithm for e+-           " <<mscStepLimit << "\n";
   os << "Type of msc step limit algorithm for muons/hadrons " <<mscStepLimitMuHad << "\n";
@@ -1191,6 +1251,9 @@ std::ostream& G4EmParameters::StreamInfo(std::ostream& os) const
 
   os << "Type of PIXE cross section for hadrons             " <<namePIXE << "\n";
   os << "Type of PIXE cross section for e+-                 " <<nameElectronPIXE << "\n";
+  if(dirPAI.size() > 0) {
+    os << "Directory for PAI tables                           " <<dirPAI << "\n";
+  }
   os << "=======================================================================" << "\n";
   os.precision(prec);
   return os;
@@ -173,6 +173,12 @@ G4EmParametersMessenger::G4EmParametersMessenger(G4EmParameters* ptr)
   IntegCmd->SetDefaultValue(true);
   IntegCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
 
+  majCmd = new G4UIcmdWithABool("/process/eLoss/lambdaMajorant",this);
+  majCmd->SetGuidance("Use per bin majorant of cross section for integral option");
+  majCmd->SetParameterName("maj",true);
+  majCmd->SetDefaultValue(false);
+  majCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
   mottCmd = new G4UIcmdWithABool("/process/msc/UseMottCorrection",this);
   mottCmd->SetGuidance("Enable usage of Mott corrections for e- elastic scattering");
   mottCmd->SetParameterName("mott",true);
@@ -185,6 +191,12 @@ G4EmParametersMessenger::G4EmParametersMessenger(G4EmParameters* ptr)
   birksCmd->SetDefaultValue(false);
   birksCmd->AvailableForStates(G4State_PreInit);
 
+  compCmd = new G4UIcmdWithABool("/process/em/compactTables",this);
+  compCmd->SetGuidance("Enable/disable single precision storage of EM tables");
+  compCmd->SetParameterName("comp",true);
+  compCmd->SetDefaultValue(false);
+  compCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
   minSubSecCmd = new G4UIcmdWithADouble("/process/eLoss/minsubsec",this);
   minSubSecCmd->SetGuidance("Set the ratio subcut/cut ");
   minSubSecCmd->SetParameterName("rcmin",true);
@@ -311,6 +323,13 @@ G4EmParametersMessenger::G4EmParametersMessenger(G4EmParameters* ptr)
   ver2Cmd->SetDefaultValue(1);
   ver2Cmd->AvailableForStates(G4State_PreInit,G4State_Idle);
 
+  thrCmd = new G4UIcmdWithAnInteger("/process/em/tableThreads",this);
+  thrCmd->SetGuidance("Set number of threads used on master for EM tables");
+  thrCmd->SetParameterName("nthr",true);
+  thrCmd->SetDefaultValue(1);
+  thrCmd->SetRange("nthr>0");
+  thrCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
   mscCmd = new G4UIcmdWithAString("/process/msc/StepLimit",this);
   mscCmd->SetGuidance("Set msc step limitation type");
   mscCmd->SetParameterName("StepLim",true);
@@ -335,6 +354,12 @@ G4EmParametersMessenger::G4EmParametersMessenger(G4EmParameters* ptr)
   pixeeXsCmd->SetCandidates("ECPSSR_Analytical Empirical Livermore Penelope");
   pixeeXsCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
 
+  dirPAICmd = new G4UIcmdWithAString("/process/em/PAIdirectory",this);
+  dirPAICmd->SetGuidance("Directory to store and retrieve PAI model tables");
+  dirPAICmd->SetParameterName("dirPAI",true);
+  dirPAICmd->SetDefaultValue("");
+  dirPAICmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
   paiCmd = new G4UIcommand("/process/em/AddPAIRegion",this);
   paiCmd->SetGuidance("Activate PAI in the G4Region.");
   paiCmd->SetGuidance("  partName  : particle name (default - all)");
@@ -547,8 +572,10 @@ G4EmParametersMessenger::~G4EmParametersMessenger()
   delete catCmd;
   delete delCmd;
   delete IntegCmd;
+  delete majCmd;
   delete mottCmd;
   delete birksCmd;
+  delete compCmd;
 
   delete minSubSecCmd;
   delete minEnCmd;
@@ -570,6 +597,7 @@ G4EmParametersMessenger::~G4EmParametersMessenger()
   delete lamCmd;
   delete amCmd;
   delete verCmd;
+  delete thrCmd;
   delete ver1Cmd;
   delete ver2Cmd;
 
@@ -578,6 +606,7 @@ G4EmParametersMessenger::~G4EmParametersMessenger()
 
   delete pixeXsCmd;
   delete pixeeXsCmd;
+  delete dirPAICmd;
 
   delete paiCmd;
   delete meCmd;
@@ -649,10 +678,16 @@ void G4EmParametersMessenger::SetNewValue(G4UIcommand* command,
   } else if (command == IntegCmd) {
     theParameters->SetIntegral(IntegCmd->GetNewBoolValue(newValue));
     physicsModified = true;
+  } else if (command == majCmd) {
+    theParameters->SetLambdaMajorant(majCmd->GetNewBoolValue(newValue));
+    physicsModified = true;
   } else if (command == mottCmd) {
     theParameters->SetUseMottCorrection(mottCmd->GetNewBoolValue(newValue));
   } else if (command == birksCmd) {
     theParameters->SetBirksActive(birksCmd->GetNewBoolValue(newValue));
+  } else if (command == compCmd) {
+    theParameters->SetCompactTables(compCmd->GetNewBoolValue(newValue));
+    physicsModified = true;
 
   } else if (command == minSubSecCmd) {
     theParameters->SetMinSubRange(minSubSecCmd->GetNewDoubleValue(newValue));
@@ -714,6 +749,8 @@ void G4EmParametersMessenger::SetNewValue(G4UIcommand* command,
     theParameters->SetVerbose(ver1Cmd->GetNewIntValue(newValue));
   } else if (command == ver2Cmd) {
     theParameters->SetWorkerVerbose(ver2Cmd->GetNewIntValue(newValue));
+  } else if (command == thrCmd) {
+    theParameters->SetNumberOfThreadsForTables(thrCmd->GetNewIntValue(newValue));
 
   } else if (command == mscCmd || command == msc1Cmd) {
     G4MscStepLimitType msctype = fUseSafety;
@@ -742,6 +779,8 @@ void G4EmParametersMessenger::SetNewValue(G4UIcommand* command,
   } else if (command == pixeeXsCmd) {
     theParameters->SetPIXEElectronCrossSectionModel(newValue);
     physicsModified = true;
+  } else if (command == dirPAICmd) {
+    theParameters->SetDirectoryPAI(newValue);
   } else if (command == paiCmd) {
     G4String s1(""),s2(""),s3("");
     std::istringstream is(newValue);
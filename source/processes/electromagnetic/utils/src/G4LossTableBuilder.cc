@@ -46,6 +46,7 @@
 // 16-01-07 Fill new (not old) DEDX table (V.Ivanchenko)
 // 12-02-07 Use G4LPhysicsFreeVector for the inverse range table (V.Ivanchenko)
 // 24-06-09 Removed hidden bin in G4PhysicsVector (V.Ivanchenko)
+// 19-10-26 Loops over couples may be shared between threads on master
 //
 // Class Description:
 //
@@ -67,6 +68,8 @@
 #include "G4ParticleDefinition.hh"
 #include "G4LossTableManager.hh"
 #include "G4EmParameters.hh"
+#include "G4Timer.hh"
+#include "G4Threading.hh"
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
@@ -104,26 +107,16 @@ G4LossTableBuilder::BuildDEDXTable(G4PhysicsTable* dedxTable,
   size_t nCouples = dedxTable->size();
   if(0 >= nCouples) { return; }
 
+  G4Timer timer;
+  timer.Start();
+  std::vector<G4PhysicsVector*> res(nCouples, nullptr);
+  BuildVectors(fBuildDEDXSum, nCouples, nullptr, &list, false, res);
+
   for (size_t i=0; i<nCouples; ++i) {
-    //    if ((*theFlag)[i]) {
-    G4PhysicsLogVector* pv0 = 
-      static_cast<G4PhysicsLogVector*>((*(list[0]))[i]);
-    if(pv0) {
-      size_t npoints = pv0->GetVectorLength();
-      G4PhysicsLogVector* pv = new G4PhysicsLogVector(*pv0);
-      pv->SetSpline(splineFlag);
-      for (size_t j=0; j<npoints; ++j) {
-        G4double dedx = 0.0;
-        for (size_t k=0; k<n_processes; ++k) {
-          G4PhysicsVector* pv1   = (*(list[k]))[i];
-          dedx += (*pv1)[j];
-        }
-        pv->PutValue(j, dedx);
-      }
-      if(splineFlag) { pv->FillSecondDerivatives(); }
-      G4PhysicsTableHelper::SetPhysicsVector(dedxTable, i, pv);
-    }
+    if(res[i]) { G4PhysicsTableHelper::SetPhysicsVector(dedxTable, i, res[i]); }
   }
+  timer.Stop();
+  PrintTiming("dedx sum", nCouples, timer);
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -136,80 +129,19 @@ void G4LossTableBuilder::BuildRangeTable(const G4PhysicsTable* dedxTable,
   size_t nCouples = dedxTable->size();
   if(0 >= nCouples) { return; }
 
-  size_t n = 100;
-  G4double del = 1.0/(G4double)n;
+  G4Timer timer;
+  timer.Start();
+  std::vector<G4PhysicsVector*> res(nCouples, nullptr);
+  BuildVectors(fBuildRange, nCouples, dedxTable, nullptr, isIonisation, res);
 
   for (size_t i=0; i<nCouples; ++i) {
-    if(isIonisation) {
-      if( !(*theFlag)[i] ) { continue; }
-    }
-    G4PhysicsLogVector* pv = static_cast<G4PhysicsLogVector*>((*dedxTable)[i]);
-    size_t npoints = pv->GetVectorLength();
-    size_t bin0    = 0;
-    G4double elow  = pv->Energy(0);
-    G4double ehigh = pv->Energy(npoints-1);
-    G4double dedx1 = (*pv)[0];
-
-    //G4cout << "i= " << i << "npoints= " << npoints << " dedx1= " 
-    //<< dedx1 << G4endl;
-
-    // protection for specific cases dedx=0
-    if(dedx1 == 0.0) {
-      for (size_t k=1; k<npoints; ++k) {
-        bin0++;
-        elow  = pv->Energy(k);
-        dedx1 = (*pv)[k];
-        if(dedx1 > 0.0) { break; }
-      }
-      npoints -= bin0;
-    }
-    //G4cout<<"New Range vector" << G4endl;
-    //G4cout<<"nbins= "<<npoints-1<<" elow= "<<elow<<" ehigh= "<<ehigh
-    //            <<" bin0= " << bin0 <<G4endl;
-
-    // initialisation of a new vector
-    if(npoints < 2) { npoints = 2; }
-
-    delete (*rangeTable)[i];
-    G4PhysicsLogVector* v;
-    if(0 == bin0) { v = new G4PhysicsLogVector(*pv); }
-    else { v = new G4PhysicsLogVector(elow, ehigh, npoints-1); }
-
-    // dedx is exact zero cannot build range table
-    if(2 == npoints) {
-      v->PutValue(0,1000.);
-      v->PutValue(1,2000.);
-      G4PhysicsTableHelper::SetPhysicsVector(rangeTable, i, v);
-      return;
-    }
-    v->SetSpline(splineFlag);
-
-    // assumed dedx proportional to beta
-    G4double energy1 = v->Energy(0);
-    G4double range   = 2.*energy1/dedx1;
-    //G4cout << "range0= " << range << G4endl;
-    v->PutValue(0,range);
-
-    for (size_t j=1; j<npoints; ++j) {
-
-      G4double energy2 = v->Energy(j);
-      G4double de      = (energy2 - energy1) * del;
-      G4double energy  = energy2 + de*0.5;
-      G4double sum = 0.0;
-      //G4cout << "j= " << j << " e1= " << energy1 << " e2= " << energy2 
-      //       << " n= " << n << G4endl;
-      for (size_t k=0; k<n; ++k) {
-        energy -= de;
-        dedx1 = pv->Value(energy);
-        if(dedx1 > 0.0) { sum += de/dedx1; }
-      }
-      range += sum;
-      v->PutValue(j,range);
-      energy1 = energy2;
+    if(res[i]) { 
+      delete (*rangeTable)[i];
+      G4PhysicsTableHelper::SetPhysicsVector(rangeTable, i, res[i]); 
     }
-    if(splineFlag) { v->FillSecondDerivatives(); }
-    G4PhysicsTableHelper::SetPhysicsVector(rangeTable, i, v);
   }
+  timer.Stop();
+  PrintTiming("range", nCouples, timer);
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -223,28 +155,371 @@ G4LossTableBuilder::BuildInverseRangeTable(const G4PhysicsTable* rangeTable,
   size_t nCouples = rangeTable->size();
   if(0 >= nCouples) { return; }
 
+  G4Timer timer;
+  timer.Start();
+  std::vector<G4PhysicsVector*> res(nCouples, nullptr);
+  BuildVectors(fBuildInverseRange, nCouples, rangeTable, nullptr, 
+               isIonisation, res);
+
   for (size_t i=0; i<nCouples; ++i) {
+    if(res[i]) { 
+      delete (*invRangeTable)[i];
+      G4PhysicsTableHelper::SetPhysicsVector(invRangeTable, i, res[i]); 
+    }
+  }
+  timer.Stop();
+  PrintTiming("inverse range", nCouples, timer);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4PhysicsVector* 
+G4LossTableBuilder::BuildDEDXVector(size_t i, 
+                                    const std::vector<G4PhysicsTable*>& list)
+{
+  G4PhysicsLogVector* pv0 = 
+    static_cast<G4PhysicsLogVector*>((*(list[0]))[i]);
+  if(!pv0) { return nullptr; }
+
+  size_t n_processes = list.size();
+  size_t npoints = pv0->GetVectorLength();
+  G4PhysicsLogVector* pv = new G4PhysicsLogVector(*pv0);
+  pv->SetSpline(splineFlag);
+  for (size_t j=0; j<npoints; ++j) {
+    G4double dedx = 0.0;
+    for (size_t k=0; k<n_processes; ++k) {
+      G4PhysicsVector* pv1 = (*(list[k]))[i];
+      dedx += (*pv1)[j];
+    }
+    pv->PutValue(j, dedx);
+  }
+  if(splineFlag) { pv->FillSecondDerivatives(); }
+  return pv;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4PhysicsVector* G4LossTableBuilder::BuildRangeVector(G4PhysicsVector* dedx)
+{
+  G4PhysicsLogVector* pv = static_cast<G4PhysicsLogVector*>(dedx);
+  size_t n = 100;
+  G4double del = 1.0/(G4double)n;
+
+  size_t npoints = pv->GetVectorLength();
+  size_t bin0    = 0;
+  G4double elow  = pv->Energy(0);
+  G4double ehigh = pv->Energy(npoints-1);
+  G4double dedx1 = (*pv)[0];
+
+  // protection for specific cases dedx=0
+  if(dedx1 == 0.0) {
+    for (size_t k=1; k<npoints; ++k) {
+      bin0++;
+      elow  = pv->Energy(k);
+      dedx1 = (*pv)[k];
+      if(dedx1 > 0.0) { break; }
+    }
+    npoints -= bin0;
+  }
+
+  // initialisation of a new vector
+  if(npoints < 2) { npoints = 2; }
+
+  G4PhysicsLogVector* v;
+  if(0 == bin0) { v = new G4PhysicsLogVector(*pv); }
+  else { v = new G4PhysicsLogVector(elow, ehigh, npoints-1); }
 
-    if(isIonisation) {
-      if( !(*theFlag)[i] ) { continue; }
+  // dedx is exact zero cannot build range table
+  if(2 == npoints) {
+    v->PutValue(0,1000.);
+    v->PutValue(1,2000.);
+    return v;
+  }
+  v->SetSpline(splineFlag);
+
+  // assumed dedx proportional to beta
+  G4double energy1 = v->Energy(0);
+  G4double range   = 2.*energy1/dedx1;
+  v->PutValue(0,range);
+
+  for (size_t j=1; j<npoints; ++j) {
+
+    G4double energy2 = v->Energy(j);
+    G4double de      = (energy2 - energy1) * del;
+    G4double energy  = energy2 + de*0.5;
+    G4double sum = 0.0;
+    for (size_t k=0; k<n; ++k) {
+      energy -= de;
+      dedx1 = pv->Value(energy);
+      if(dedx1 > 0.0) { sum += de/dedx1; }
     }
-    G4PhysicsVector* pv = (*rangeTable)[i];
-    size_t npoints = pv->GetVectorLength();
-    G4double rlow  = (*pv)[0];
-    G4double rhigh = (*pv)[npoints-1];
+    range += sum;
+    v->PutValue(j,range);
+    energy1 = energy2;
+  }
+  if(splineFlag) { v->FillSecondDerivatives(); }
+  return v;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4PhysicsVector* 
+G4LossTableBuilder::BuildInverseRangeVector(const G4PhysicsVector* pv)
+{
+  size_t npoints = pv->GetVectorLength();
+  G4double rlow  = (*pv)[0];
+  G4double rhigh = (*pv)[npoints-1];
       
-    delete (*invRangeTable)[i];
-    G4LPhysicsFreeVector* v = new G4LPhysicsFreeVector(npoints,rlow,rhigh);
-    v->SetSpline(splineFlag);
-
-    for (size_t j=0; j<npoints; ++j) {
-      G4double e  = pv->Energy(j);
-      G4double r  = (*pv)[j];
-      v->PutValues(j,r,e);
+  G4LPhysicsFreeVector* v = new G4LPhysicsFreeVector(npoints,rlow,rhigh);
+  v->SetSpline(splineFlag);
+
+  for (size_t j=0; j<npoints; ++j) {
+    G4double e  = pv->Energy(j);
+    G4double r  = (*pv)[j];
+    v->PutValues(j,r,e);
+  }
+  if(splineFlag) { v->FillSecondDerivatives(); }
+  return v;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4PhysicsVector* 
+G4LossTableBuilder::BuildVector(const G4LossTableBuilderTask* task, size_t i)
+{
+  if(task->isIonisation && !(*theFlag)[i]) { return nullptr; }
+  G4PhysicsVector* v = nullptr;
+  switch(task->type) {
+  case fBuildDEDXSum:
+    v = BuildDEDXVector(i, *(task->list));
+    break;
+  case fBuildRange:
+    if((*(task->input))[i]) { v = BuildRangeVector((*(task->input))[i]); }
+    break;
+  case fBuildInverseRange:
+    if((*(task->input))[i]) { 
+      v = BuildInverseRangeVector((*(task->input))[i]); 
     }
-    if(splineFlag) { v->FillSecondDerivatives(); }
+    break;
+  }
+  return v;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
-    G4PhysicsTableHelper::SetPhysicsVector(invRangeTable, i, v);
+G4ThreadFunReturnType 
+G4LossTableBuilder::BuildVectorsThread(G4ThreadFunArgType arg)
+{
+  G4LossTableBuilderTask* task = static_cast<G4LossTableBuilderTask*>(arg);
+  // each couple is handled by exactly one thread, so the result 
+  // does not depend on the number of threads
+  for(size_t i=task->first; i<task->nCouples; i+=task->stride) {
+    (*(task->result))[i] = task->builder->BuildVector(task, i);
+  }
+  return 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void 
+G4LossTableBuilder::BuildVectors(G4LossTableBuilderType type, size_t nCouples,
+                                 const G4PhysicsTable* input,
+                                 const std::vector<G4PhysicsTable*>* list,
+                                 G4bool isIonisation,
+                                 std::vector<G4PhysicsVector*>& result)
+{
+  size_t nthreads = 1;
+#ifdef G4MULTITHREADED
+  nthreads = std::min((size_t)theParameters->NumberOfThreadsForTables(), 
+                      nCouples);
+  if(0 == nthreads) { nthreads = 1; }
+#endif
+  std::vector<G4LossTableBuilderTask> tasks(nthreads);
+  for(size_t t=0; t<nthreads; ++t) {
+    G4LossTableBuilderTask& task = tasks[t];
+    task.builder  = this;
+    task.type     = type;
+    task.input    = input;
+    task.list     = list;
+    task.result   = &result;
+    task.nCouples = nCouples;
+    task.first    = t;
+    task.stride   = nthreads;
+    task.isIonisation = isIonisation;
+  }
+#ifdef G4MULTITHREADED
+  if(1 < nthreads) {
+    std::vector<G4Thread> threads(nthreads - 1);
+    for(size_t t=1; t<nthreads; ++t) {
+      G4THREADCREATE(&threads[t-1], BuildVectorsThread, &tasks[t]);
+    }
+    BuildVectorsThread(&tasks[0]);
+    for(size_t t=1; t<nthreads; ++t) { G4THREADJOIN(threads[t-1]); }
+    return;
+  }
+#endif
+  BuildVectorsThread(&tasks[0]);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4LossTableBuilder::CompactTable(G4PhysicsTable* table, 
+                                      const G4String& name)
+{
+  if(!table || !theParameters->CompactTables()) { return; }
+
+  G4double dmax = 0.0;
+  size_t mem0 = 0;
+  size_t mem1 = 0;
+  size_t nCouples = table->size();
+  for(size_t i=0; i<nCouples; ++i) {
+    G4PhysicsVector* v = (*table)[i];
+    if(v && !v->IsCompact()) { 
+      mem0 += v->GetMemorySize();
+      dmax = std::max(dmax, v->Compact()); 
+      mem1 += v->GetMemorySize();
+    }
+  }
+  if(theParameters->Verbose() > 0 && mem0 > 0 
+     && G4Threading::IsMasterThread()) {
+    G4cout << "G4LossTableBuilder: " << name 
+           << " table in single precision: max relative deviation " 
+           << dmax << "; memory " << mem0/1024 << " kB -> " 
+           << mem1/1024 << " kB" << G4endl;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4LossTableBuilder::BuildLambdaMajorant(const G4PhysicsTable* table,
+                                             G4double factor,
+                                             std::vector<G4double>& majorant,
+                                             std::vector<size_t>& offset)
+{
+  majorant.clear();
+  offset.clear();
+  if(!table) { return; }
+
+  // the maximum of the interpolant in each bin is exact up to rounding;
+  // tables may be converted to single precision after this call
+  G4double margin = theParameters->CompactTables() ? 1.0 + 1.e-5 : 1.0 + 1.e-9;
+
+  size_t nCouples = table->size();
+  offset.resize(nCouples, 0);
+  std::vector<G4double> binMax;
+  for(size_t i=0; i<nCouples; ++i) {
+    const G4PhysicsVector* pv = (*table)[i];
+    offset[i] = majorant.size();
+    if(!pv) { continue; }
+    size_t nb = pv->GetVectorLength();
+    if(nb < 2) {
+      majorant.push_back((nb == 1) ? margin*(*pv)[0] : 0.0);
+      continue;
+    }
+    binMax.resize(nb-1);
+    for(size_t j=0; j<nb-1; ++j) { binMax[j] = MaxInBin(pv, j); }
+
+    size_t idx = 0;
+    for(size_t j=0; j<nb-1; ++j) {
+      // first bin of the interval including E_j*factor
+      size_t k = pv->FindBin(pv->Energy(j)*factor, idx);
+      G4double smax = 0.0;
+      for(; k<=j; ++k) { smax = std::max(smax, binMax[k]); }
+      majorant.push_back(margin*smax);
+    }
+  }
+  // couples without own vectors use the data of the base couple
+  for(size_t i=0; i<nCouples; ++i) {
+    if(!(*table)[i]) {
+      size_t j = (*theDensityIdx)[i];
+      if(j < nCouples) { offset[i] = offset[j]; }
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4LossTableBuilder::MaxInInterval(const G4PhysicsVector* pv,
+                                           G4double e1, G4double e2)
+{
+  size_t nb = pv->GetVectorLength();
+  if(0 == nb) { return 0.0; }
+  if(1 == nb) { return (*pv)[0]; }
+
+  G4double res = 0.0;
+  if(e1 < pv->Energy(0))           { res = (*pv)[0]; }
+  if(e2 > pv->Energy(nb-1))        { res = std::max(res, (*pv)[nb-1]); }
+  // all bins overlapping the interval
+  for(size_t j=0; j<nb-1; ++j) {
+    if(pv->Energy(j+1) < e1) { continue; }
+    if(pv->Energy(j) > e2)   { break; }
+    res = std::max(res, MaxInBin(pv, j));
+  }
+  return res;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4LossTableBuilder::MaxInBin(const G4PhysicsVector* pv, size_t idx)
+{
+  // Inside a bin the linear or spline interpolant is a polynomial of 
+  // degree 3 at most in the reduced variable t = 3*(e - E_idx)/(E_idx+1 - E_idx);
+  // it is fixed by its values at t = 0,1,2,3 and its maximum is either
+  // at a node or at a zero of its derivative in ]0,3[ 
+  G4double e1 = pv->Energy(idx);
+  G4double delta = pv->Energy(idx+1) - e1;
+  G4double f0 = (*pv)[idx];
+  G4double f3 = (*pv)[idx+1];
+  G4double res = std::max(f0, f3);
+
+  size_t lastIdx = idx;
+  G4double f1 = pv->Value(e1 + delta/3., lastIdx);
+  G4double f2 = pv->Value(e1 + 2.*delta/3., lastIdx);
+  res = std::max(res, std::max(f1, f2));
+
+  // forward differences and derivative A*t^2 + B*t + C of the
+  // Newton polynomial
+  G4double d1 = f1 - f0;
+  G4double d2 = f2 - 2.*f1 + f0;
+  G4double d3 = f3 - 3.*f2 + 3.*f1 - f0;
+  G4double a = 0.5*d3;
+  G4double b = d2 - d3;
+  G4double c = d1 - 0.5*d2 + d3/3.;
+
+  G4double t[2];
+  G4int nt = 0;
+  if(std::abs(a) > 1.e-12*(std::abs(b) + std::abs(c))) {
+    G4double disc = b*b - 4.*a*c;
+    if(disc >= 0.0) {
+      G4double q = -0.5*(b + ((b < 0.0) ? -1.0 : 1.0)*std::sqrt(disc));
+      t[nt++] = q/a;
+      if(q != 0.0) { t[nt++] = c/q; }
+    }
+  } else if(b != 0.0) {
+    t[nt++] = -c/b;
+  }
+  for(G4int k=0; k<nt; ++k) {
+    if(t[k] > 0.0 && t[k] < 3.0) {
+      lastIdx = idx;
+      res = std::max(res, pv->Value(e1 + t[k]*delta/3., lastIdx));
+    }
+  }
+  return res;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4LossTableBuilder::PrintTiming(const G4String& name, size_t nCouples,
+                                     const G4Timer& timer)
+{
+  if(theParameters->Verbose() > 1 && G4Threading::IsMasterThread()) {
+    G4cout << "G4LossTableBuilder: " << name << " table for " << nCouples
+           << " couples is built in " << timer.GetRealElapsed() << " s"
+#ifdef G4MULTITHREADED
+           << " using " << theParameters->NumberOfThreadsForTables() 
+           << " threads"
+#endif
+           << G4endl;
   }
 }
 
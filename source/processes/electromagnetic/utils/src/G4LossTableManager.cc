@@ -104,6 +104,7 @@
 #include "G4Region.hh"
 #include "G4PhysicalConstants.hh"
 #include "G4Threading.hh"
+#include "G4Timer.hh"
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
@@ -782,7 +783,16 @@ G4VEnergyLossProcess* G4LossTableManager::BuildTables(
         G4bool val = false;
         if (!tables_are_built[i]) {
           val = true;
+          G4Timer timer;
+          timer.Start();
           dedx = p->BuildDEDXTable(fRestricted);
+          timer.Stop();
+          if(1 < verbose) {
+            G4cout << "G4LossTableManager: dedx table of " 
+                   << p->GetProcessName() << " for "
+                   << aParticle->GetParticleName() << " is built in "
+                   << timer.GetRealElapsed() << " s" << G4endl;
+          }
           //G4cout << "Build DEDX table for " << p->GetProcessName()
           // << " idx= " << i << dedx << " " << dedx->length() << G4endl;
           p->SetDEDXTable(dedx,fRestricted);
@@ -866,7 +876,16 @@ G4VEnergyLossProcess* G4LossTableManager::BuildTables(
     p = loss_list[i];
     if(p != em) { p->SetIonisation(false); }
     if(build_flags[i]) {
+      G4Timer timer;
+      timer.Start();
       p->SetLambdaTable(p->BuildLambdaTable(fRestricted));
+      timer.Stop();
+      if(1 < verbose) {
+        G4cout << "G4LossTableManager: lambda table of " 
+               << p->GetProcessName() << " for "
+               << aParticle->GetParticleName() << " is built in "
+               << timer.GetRealElapsed() << " s" << G4endl;
+      }
     }
     if (0 < nSubRegions) {
       dedx = p->BuildDEDXTable(fSubRestricted);
@@ -908,6 +927,24 @@ G4VEnergyLossProcess* G4LossTableManager::BuildTables(
     em->SetCSDARangeTable(rCSDA);
   }
 
+  // optional single precision storage
+  if(theParameters->CompactTables()) {
+    const G4String& pname = aParticle->GetParticleName();
+    for (i=0; i<n_dedx; ++i) {
+      p = loss_list[i];
+      if(build_flags[i]) {
+        G4String name = p->GetProcessName() + " " + pname;
+        tableBuilder->CompactTable(t_list[i], "dedx " + name);
+        tableBuilder->CompactTable(p->LambdaTable(), "lambda " + name);
+        tableBuilder->CompactTable(p->SubLambdaTable(), "sublambda " + name);
+      }
+    }
+    G4String name = em->GetProcessName() + " " + pname;
+    tableBuilder->CompactTable(em->DEDXTable(), "dedx sum " + name);
+    tableBuilder->CompactTable(em->RangeTableForLoss(), "range " + name);
+    tableBuilder->CompactTable(em->CSDARangeTable(), "CSDA range " + name);
+  }
+
   if (1 < verbose) {
     G4cout << "G4LossTableManager::BuildTables: Tables are built for "
            << aParticle->GetParticleName()
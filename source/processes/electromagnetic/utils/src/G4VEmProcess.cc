@@ -53,6 +53,9 @@
 // 24-06-09 Removed hidden bin in G4PhysicsVector (V.Ivanchenko)
 // 17-02-10 Added pointer currentParticle (VI)
 // 30-05-12 allow Russian roulette, brem splitting (D. Sawkey)
+// 19-10-26 lambda majorant for integral approach, counters (VI)
+// 19-10-26 added AllowFusedStepLimit()
+// 19-10-26 added GetMaxLambda()
 //
 // Class Description:
 //
@@ -84,6 +87,7 @@
 #include "G4EmBiasingManager.hh"
 #include "G4GenericIon.hh"
 #include "G4Log.hh"
+#include "G4Timer.hh"
 #include <iostream>
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -98,6 +102,8 @@ G4VEmProcess::G4VEmProcess(const G4String& name, G4ProcessType type):
   theDensityFactor(nullptr),
   theDensityIdx(nullptr),
   integral(false),
+  useMajorant(false),
+  allModelsActive(false),
   applyCuts(false),
   startFromNull(false),
   splineFlag(true),
@@ -138,8 +144,9 @@ G4VEmProcess::G4VEmProcess(const G4String& name, G4ProcessType type):
   preStepLambda = preStepKinEnergy = 0.0;
   mfpKinEnergy  = DBL_MAX;
 
-  idxLambda = idxLambdaPrim = currentCoupleIndex 
+  idxLambda = idxLambdaPrim = idxMajorant = currentCoupleIndex 
     = basedCoupleIndex = 0;
+  nLambdaCalls = nFictitious = nInteractions = 0;
 
   modelManager = new G4EmModelManager();
   biasManager  = nullptr;
@@ -164,6 +171,14 @@ G4VEmProcess::~G4VEmProcess()
            << "  " << this << "  " <<  theLambdaTable <<G4endl;
   }
   */
+  if(1 < verboseLevel && integral && 0 < nLambdaCalls) {
+    G4cout << "G4VEmProcess: " << GetProcessName() << " for "
+           << particle->GetParticleName() 
+           << (useMajorant ? " with lambda majorant" : "")
+           << "; lambda computed " << nLambdaCalls 
+           << " times, interactions " << nInteractions 
+           << ", rejected " << nFictitious << G4endl;
+  }
   if(lManager->IsMaster()) {
     if(theLambdaTable) {
       theLambdaTable->clearAndDestroy();
@@ -187,7 +202,7 @@ void G4VEmProcess::Clear()
   currentCouple = nullptr;
   preStepLambda = 0.0;
   mfpKinEnergy  = DBL_MAX;
-  idxLambda = idxLambdaPrim = 0;
+  idxLambda = idxLambdaPrim = idxMajorant = 0;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -334,6 +349,17 @@ void G4VEmProcess::PreparePhysicsTable(const G4ParticleDefinition& part)
       mod->SetHighEnergyLimit(maxKinEnergy);
     }
   }
+  // if models are active in the full energy range the model
+  // may be selected only at the interaction point
+  allModelsActive = true;
+  for(G4int i=0; i<numberOfModels; ++i) {
+    G4VEmModel* mod = modelManager->GetModel(i);
+    if(mod->LowEnergyActivationLimit() > 0.0 || 
+       mod->HighEnergyActivationLimit() < DBL_MAX) { 
+      allModelsActive = false; 
+    }
+  }
+  useMajorant = integral && theParameters->LambdaMajorant();
 
   if(lManager->AtomDeexcitation()) { modelManager->SetFluoFlag(true); }
   theCuts = modelManager->Initialise(particle,secondaryParticle,
@@ -456,6 +482,8 @@ void G4VEmProcess::BuildLambdaTable()
            << particle->GetParticleName() << "  " << this
            << G4endl;
   }
+  G4Timer timer;
+  timer.Start();
 
   // Access to materials
   const G4ProductionCutsTable* theCoupleTable=
@@ -532,11 +560,19 @@ void G4VEmProcess::BuildLambdaTable()
     }
   }
 
+  // optional single precision storage
+  G4String name = GetProcessName() + " " + particle->GetParticleName();
+  bld->CompactTable(theLambdaTable, "lambda " + name);
+  bld->CompactTable(theLambdaTablePrim, "lambdaPrim " + name);
+
   if(buildLambdaTable) { FindLambdaMax(); }
 
+  timer.Stop();
   if(1 < verboseLevel) {
     G4cout << "Lambda table is built for "
            << particle->GetParticleName()
+           << " and " << numOfCouples << " couples in "
+           << timer.GetRealElapsed() << " s"
            << G4endl;
   }
 }
@@ -616,6 +652,13 @@ void G4VEmProcess::PrintInfoProcess(const G4ParticleDefinition& part)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+G4bool G4VEmProcess::AllowFusedStepLimit() const
+{
+  return (!integral && !biasManager);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 void G4VEmProcess::StartTracking(G4Track* track)
 {
   // reset parameters for the new track
@@ -645,12 +688,18 @@ G4double G4VEmProcess::PostStepGetPhysicalInteractionLength(
 
   preStepKinEnergy = track.GetKineticEnergy();
   DefineMaterial(track.GetMaterialCutsCouple());
-  SelectModel(preStepKinEnergy, currentCoupleIndex);
 
-  if(!currentModel->IsActive(preStepKinEnergy)) { 
-    theNumberOfInteractionLengthLeft = -1.0;
-    currentInteractionLength = DBL_MAX;
-    return x; 
+  // lambda from tables does not depend on the model, 
+  // the model is selected in PostStepDoIt
+  if(!useMajorant || !allModelsActive || 
+     (!theLambdaTable && preStepKinEnergy < minKinEnergyPrim)) {
+    SelectModel(preStepKinEnergy, currentCoupleIndex);
+
+    if(!currentModel->IsActive(preStepKinEnergy)) { 
+      theNumberOfInteractionLengthLeft = -1.0;
+      currentInteractionLength = DBL_MAX;
+      return x; 
+    }
   }
  
   // forced biasing only for primary particles
@@ -750,9 +799,11 @@ G4VParticleChange* G4VEmProcess::PostStepDoIt(const G4Track& track,
     }
 
     if(preStepLambda*G4UniformRand() > lx) {
+      ++nFictitious;
       ClearNumberOfInteractionLengthLeft();
       return &fParticleChange;
     }
+    ++nInteractions;
   }
 
   SelectModel(finalT, currentCoupleIndex);
@@ -1041,6 +1092,32 @@ G4double G4VEmProcess::MeanFreePath(const G4Track& track)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+G4double G4VEmProcess::GetMaxLambda(G4double e1, G4double e2,
+                                    const G4MaterialCutsCouple* couple)
+{
+  DefineMaterial(couple);
+  G4double x = 0.0;
+  if(e1 < minKinEnergyPrim) {
+    if(!theLambdaTable || !(*theLambdaTable)[basedCoupleIndex]) { 
+      return -1.0; 
+    }
+    x = G4LossTableBuilder::MaxInInterval(
+      (*theLambdaTable)[basedCoupleIndex], e1, std::min(e2, minKinEnergyPrim));
+  }
+  if(e2 >= minKinEnergyPrim) {
+    if(!theLambdaTablePrim || !(*theLambdaTablePrim)[basedCoupleIndex]) { 
+      return -1.0; 
+    }
+    // lambda*e is tabulated above minKinEnergyPrim
+    G4double e = std::max(e1, minKinEnergyPrim);
+    x = std::max(x, G4LossTableBuilder::MaxInInterval(
+                      (*theLambdaTablePrim)[basedCoupleIndex], e, e2)/e);
+  }
+  return fFactor*x;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 G4double 
 G4VEmProcess::ComputeCrossSectionPerAtom(G4double kineticEnergy, 
                                          G4double Z, G4double A, G4double cut)
@@ -1104,6 +1181,13 @@ void G4VEmProcess::FindLambdaMax()
       theCrossSectionMax[i] = (*theDensityFactor)[i]*theCrossSectionMax[j];
     }
   }
+  if(useMajorant) {
+    lManager->GetTableBuilder()->BuildLambdaMajorant(theLambdaTable, 
+      lambdaFactor, theLambdaMajorant, theMajorantOffset);
+  } else {
+    theLambdaMajorant.clear();
+    theMajorantOffset.clear();
+  }
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
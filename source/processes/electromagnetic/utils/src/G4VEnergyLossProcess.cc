@@ -117,6 +117,7 @@
 // 30-05-12 Fix bug in forced biasing: now called on first step (D. Sawkey)
 // 04-06-13 Adoptation to MT mode, adding internal cache to GetRangeForLoss,
 //          more accurate initialisation for ions (V.Ivanchenko)
+// 19-10-26 lambda majorant for integral approach, counters (VI)
 //
 // Class Description:
 //
@@ -189,6 +190,7 @@ G4VEnergyLossProcess::G4VEnergyLossProcess(const G4String& name,
   rndmStepFlag(false),
   tablesAreBuilt(false),
   integral(true),
+  useMajorant(false),
   isIon(false),
   isIonisation(true),
   useSubCutoff(false),
@@ -256,7 +258,8 @@ G4VEnergyLossProcess::G4VEnergyLossProcess(const G4String& name,
 
   idxDEDX = idxDEDXSub = idxDEDXunRestricted = idxIonisation =
     idxIonisationSub = idxRange = idxCSDA = idxSecRange =
-    idxInverseRange = idxLambda = idxSubLambda = 0;
+    idxInverseRange = idxLambda = idxSubLambda = idxMajorant = 0;
+  nLambdaCalls = nFictitious = nInteractions = 0;
 
   scTracks.reserve(5);
   secParticles.reserve(5);
@@ -280,6 +283,14 @@ G4VEnergyLossProcess::~G4VEnergyLossProcess()
          << "  basePart: " << baseParticle 
          << G4endl;
   */
+  if(1 < verboseLevel && integral && 0 < nLambdaCalls) {
+    G4cout << "G4VEnergyLossProcess: " << GetProcessName() << " for "
+           << particle->GetParticleName() 
+           << (useMajorant ? " with lambda majorant" : "")
+           << "; lambda computed " << nLambdaCalls 
+           << " times, interactions " << nInteractions 
+           << ", rejected " << nFictitious << G4endl;
+  }
   Clean();
 
   // G4cout << " isIonisation " << isIonisation << "  " 
@@ -374,7 +385,7 @@ void G4VEnergyLossProcess::Clean()
 
   idxDEDX = idxDEDXSub = idxDEDXunRestricted = idxIonisation =
     idxIonisationSub = idxRange = idxCSDA = idxSecRange =
-    idxInverseRange = idxLambda = idxSubLambda = 0;
+    idxInverseRange = idxLambda = idxSubLambda = idxMajorant = 0;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -524,6 +535,7 @@ G4VEnergyLossProcess::PreparePhysicsTable(const G4ParticleDefinition& part)
 
   // parameters of the process
   if(!actIntegral) { integral = theParameters->Integral(); }
+  useMajorant = integral && theParameters->LambdaMajorant();
   if(!actLossFluc) { lossFluctuationFlag = theParameters->LossFluctuation(); }
   rndmStepFlag = theParameters->UseCutAsFinalRange();
   if(!actMinKinEnergy) { minKinEnergy = theParameters->MinKinEnergy(); }
@@ -1662,8 +1674,10 @@ G4VParticleChange* G4VEnergyLossProcess::PostStepDoIt(const G4Track& track,
     }
     */
     if(lx <= 0.0 || preStepLambda*G4UniformRand() > lx) {
+      ++nFictitious;
       return &fParticleChange;
     }
+    ++nInteractions;
   }
 
   SelectModel(postStepScaledEnergy);
@@ -2242,6 +2256,13 @@ void G4VEnergyLossProcess::SetLambdaTable(G4PhysicsTable* p)
       }
     }
   }
+  if(theLambdaTable && useMajorant) {
+    bld->BuildLambdaMajorant(theLambdaTable, lambdaFactor, 
+                             theLambdaMajorant, theMajorantOffset);
+  } else {
+    theLambdaMajorant.clear();
+    theMajorantOffset.clear();
+  }
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -34,6 +34,7 @@
 //
 // August 2011  Re-designed
 //              by G. Folger, V. Ivantchenko, T. Koi and D.H. Wright
+// 19.10.2026   optional per material tables of element cross sections
 
 // Class Description
 // This is the class to which cross section data sets may be registered. 
@@ -84,8 +85,10 @@ public:
   G4Element* SampleZandA(const G4DynamicParticle*, const G4Material*,
 			 G4Nucleus& target);
 
-  // Initialisation before run
-  void BuildPhysicsTable(const G4ParticleDefinition&);
+  // Initialisation before run; in worker threads the cross section 
+  // tables of the store of the master process are shared if available
+  void BuildPhysicsTable(const G4ParticleDefinition&,
+                         const G4CrossSectionDataStore* masterStore = nullptr);
 
   // Dump store to G4cout
   void DumpPhysicsTable(const G4ParticleDefinition&);
@@ -98,8 +101,26 @@ public:
 
   inline void SetVerboseLevel(G4int value);
 
+  // Precomputed per material cumulative element cross sections, 
+  // used inside the energy interval of the table only; 
+  // these options should be set before initialisation, tables are
+  // built by the master (or sequential) store and read by workers
+  inline void SetCrossSectionTables(G4bool val);
+  void SetCrossSectionTableLimits(G4double emin, G4double emax,
+                                  G4int nbinsPerDecade);
+  inline G4bool CrossSectionTables() const;
+
+  inline G4long GetNumberOfTableHits() const;
+  inline G4long GetNumberOfTableMisses() const;
+  inline G4bool HasCrossSectionTables() const;
+
 private:
 
+  void BuildCrossSectionTables(const G4ParticleDefinition&);
+
+  G4bool IsApplicable(const G4DynamicParticle*, const G4Element*, 
+		      const G4Material*);
+
   G4double GetIsoCrossSection(const G4DynamicParticle*, G4int Z, G4int A,
 			      const G4Isotope*,
 			      const G4Element*, const G4Material* aMaterial,
@@ -129,6 +150,32 @@ private:
 
   G4int nDataSetList;
   G4int verboseLevel;
+
+  // tables of cumulative element cross sections per material,
+  // for material with index m and energy node k the cross section 
+  // for element i is data[offset[m] + k*nElements + i]
+  struct G4CrossSectionTables
+  {
+    const G4ParticleDefinition* particle;
+    std::vector<G4double> energy;
+    std::vector<G4double> data;
+    std::vector<G4int> offset;
+    G4double logEmin;
+    G4double invLogStep;
+  };
+
+  // tables built by this store, and tables in use which are either
+  // these or the read-only tables of the master store
+  G4CrossSectionTables* ownTables;
+  const G4CrossSectionTables* tables;
+  G4long nTableHits;
+  G4long nTableMisses;
+
+  G4bool   useTables;
+  G4double tableEmin;
+  G4double tableEmax;
+  G4int    tableBinsPerDecade;
+
   //Fast path: caching
 public:
   inline const G4FastPathHadronicCrossSection::fastPathParameters&
@@ -168,4 +215,29 @@ inline void G4CrossSectionDataStore::SetVerboseLevel(G4int value)
   verboseLevel = value;
 }
 
+inline G4long G4CrossSectionDataStore::GetNumberOfTableHits() const
+{
+  return nTableHits;
+}
+
+inline G4long G4CrossSectionDataStore::GetNumberOfTableMisses() const
+{
+  return nTableMisses;
+}
+
+inline G4bool G4CrossSectionDataStore::HasCrossSectionTables() const
+{
+  return (nullptr != tables);
+}
+
+inline void G4CrossSectionDataStore::SetCrossSectionTables(G4bool val)
+{
+  useTables = val;
+}
+
+inline G4bool G4CrossSectionDataStore::CrossSectionTables() const
+{
+  return useTables;
+}
+
 #endif
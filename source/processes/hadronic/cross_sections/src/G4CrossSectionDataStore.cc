@@ -38,6 +38,7 @@
 // 14.03.2011 V.Ivanchenko fixed DumpPhysicsTable
 // 15.08.2011 G.Folger, V.Ivanchenko, T.Koi, D.Wright redesign the class
 // 07.03.2013 M.Maire cosmetic in DumpPhysicsTable
+// 19.10.2026 optional per material tables of element cross sections
 //
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
@@ -55,6 +56,8 @@
 #include "G4Element.hh"
 #include "G4Material.hh"
 #include "G4NistManager.hh"
+#include "G4Log.hh"
+#include "G4Exp.hh"
 #include <algorithm>
 
 
@@ -69,12 +72,21 @@ G4CrossSectionDataStore::G4CrossSectionDataStore() :
   currentElement = 0;  //ALB 14-Aug-2012 Coverity fix.
   matParticle = elmParticle = 0;
   matKinEnergy = elmKinEnergy = matCrossSection = elmCrossSection = 0.0;
+  ownTables = nullptr;
+  tables = nullptr;
+  nTableHits = nTableMisses = 0;
+  useTables = false;
+  tableEmin = 20*MeV;
+  tableEmax = 100*TeV;
+  tableBinsPerDecade = 20;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
 G4CrossSectionDataStore::~G4CrossSectionDataStore()
-{}
+{
+  delete ownTables;
+}
 
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
@@ -229,10 +241,38 @@ G4CrossSectionDataStore::GetCrossSection(const G4DynamicParticle* part,
 
 	  if(G4int(xsecelm.size()) < nElements) { xsecelm.resize(nElements); }
 
-	  for(G4int i=0; i<nElements; ++i) {
+	  // interpolation of the precomputed cumulative cross sections
+	  G4double e = part->GetKineticEnergy();
+	  G4int offset = -1;
+	  if(nullptr != tables && part->GetDefinition() == tables->particle) {
+	    size_t idx = mat->GetIndex();
+	    if(idx < tables->offset.size()) { offset = tables->offset[idx]; }
+	  }
+	  if(0 <= offset && e >= tables->energy[0] && 
+	     e < tables->energy.back()) {
+	    ++nTableHits;
+	    const G4double* en = &(tables->energy[0]);
+	    size_t nbins = tables->energy.size() - 1;
+	    size_t k = std::min(size_t((G4Log(e) - tables->logEmin)
+				       *tables->invLogStep), nbins - 1);
+	    if(e < en[k]) { --k; }
+	    else if(e >= en[k+1]) { ++k; }
+	    k = std::min(k, nbins - 1);
+	    G4double w1 = (e - en[k])/(en[k+1] - en[k]);
+	    G4double w0 = 1.0 - w1;
+	    const G4double* x0 = &(tables->data[offset + k*nElements]);
+	    const G4double* x1 = x0 + nElements;
+	    for(G4int i=0; i<nElements; ++i) {
+	      xsecelm[i] = w0*x0[i] + w1*x1[i];
+	    }
+	    matCrossSection = xsecelm[nElements - 1];
+	  } else {
+	    if(nullptr != tables) { ++nTableMisses; }
+	    for(G4int i=0; i<nElements; ++i) {
 		  matCrossSection += nAtomsPerVolume[i] *
 				  GetCrossSection(part, (*mat->GetElementVector())[i], mat);
 		  xsecelm[i] = matCrossSection;
+	    }
 	  }
   }
   //Stop measurement of cpu cycles
@@ -493,7 +533,8 @@ G4CrossSectionDataStore::SampleZandA(const G4DynamicParticle* part,
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
 void
-G4CrossSectionDataStore::BuildPhysicsTable(const G4ParticleDefinition& aParticleType)
+G4CrossSectionDataStore::BuildPhysicsTable(const G4ParticleDefinition& aParticleType,
+                                           const G4CrossSectionDataStore* masterStore)
 {
   if (nDataSetList == 0) 
     {
@@ -524,8 +565,146 @@ G4CrossSectionDataStore::BuildPhysicsTable(const G4ParticleDefinition& aParticle
 	  	  );
 	  fastPathFlags.initializationPhase = false;
   }
+  if(nullptr != masterStore && this != masterStore) {
+    // worker thread: the tables of the master are used read-only
+    if(nullptr != masterStore->tables && 
+       &aParticleType == masterStore->tables->particle) { 
+      tables = masterStore->tables; 
+    } else {
+      tables = nullptr;
+    }
+  } else if(useTables) { 
+    BuildCrossSectionTables(aParticleType); 
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void 
+G4CrossSectionDataStore::BuildCrossSectionTables(const G4ParticleDefinition& p)
+{
+  // tables are built for the first particle only, ions are 
+  // tracked with their own definitions and use the normal path
+  if(nullptr != ownTables && nullptr != ownTables->particle &&
+     &p != ownTables->particle) { return; }
+  if(nullptr == ownTables) { ownTables = new G4CrossSectionTables(); }
+  tables = nullptr;
+  G4CrossSectionTables* tab = ownTables;
+  tab->particle = nullptr;
+  tab->energy.clear();
+  tab->data.clear();
+  tab->offset.clear();
+  if(tableEmax <= tableEmin || 0 >= tableBinsPerDecade) { return; }
+
+  G4int nbins = std::max(G4lrint(tableBinsPerDecade
+				 *std::log10(tableEmax/tableEmin)), 1);
+  tab->logEmin = G4Log(tableEmin);
+  tab->invLogStep = nbins/(G4Log(tableEmax) - tab->logEmin);
+  G4double step = 1.0/tab->invLogStep;
+  std::vector<G4double>& tabEnergy = tab->energy;
+  tabEnergy.resize(nbins + 1);
+  for(G4int k=0; k<=nbins; ++k) { 
+    tabEnergy[k] = G4Exp(tab->logEmin + k*step); 
+  }
+  tabEnergy[0] = tableEmin;
+  tabEnergy[nbins] = tableEmax;
+
+  G4DynamicParticle dp(&p, G4ThreeVector(0.0,0.0,1.0), tableEmin);
+  const G4MaterialTable* theMaterialTable = G4Material::GetMaterialTable();
+  size_t nMaterials = G4Material::GetNumberOfMaterials();
+  tab->offset.resize(nMaterials, -1);
+  std::vector<G4double> row;
+  G4int nTables = 0;
+
+  for(size_t im=0; im<nMaterials; ++im) {
+    const G4Material* mat = (*theMaterialTable)[im];
+    G4int nElements = mat->GetNumberOfElements();
+    const G4ElementVector* theElementVector = mat->GetElementVector();
+    const G4double* nAtomsPerVolume = mat->GetVecNbOfAtomsPerVolume();
+    row.resize((nbins + 1)*nElements);
+    G4bool ok = true;
+    for(G4int k=0; k<=nbins && ok; ++k) {
+      dp.SetKineticEnergy(tabEnergy[k]);
+      G4double cross = 0.0;
+      for(G4int i=0; i<nElements; ++i) {
+	const G4Element* elm = (*theElementVector)[i];
+	if(!IsApplicable(&dp, elm, mat)) { ok = false; break; }
+	cross += nAtomsPerVolume[i]*GetCrossSection(&dp, elm, mat);
+	row[k*nElements + i] = cross;
+      }
+    }
+    if(ok) {
+      tab->offset[im] = G4int(tab->data.size());
+      tab->data.insert(tab->data.end(), row.begin(), row.end());
+      ++nTables;
+    }
+  }
+  // reset caches filled with the temporary particle
+  currentMaterial = elmMaterial = nullptr;
+  currentElement = nullptr;
+  matParticle = elmParticle = nullptr;
+
+  if(0 < nTables) { 
+    tab->particle = &p; 
+    tables = tab;
+  }
+  if(verboseLevel > 1) {
+    G4cout << "G4CrossSectionDataStore::BuildCrossSectionTables for "
+	   << p.GetParticleName() << ": " << nTables << " of " << nMaterials
+	   << " materials tabulated from " << G4BestUnit(tableEmin, "Energy")
+	   << " to " << G4BestUnit(tableEmax, "Energy") << " in " 
+	   << nbins << " bins" << G4endl;
+  }
 }
 
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+G4bool G4CrossSectionDataStore::IsApplicable(const G4DynamicParticle* part,
+					     const G4Element* elm,
+					     const G4Material* mat)
+{
+  // check done without exceptions, which are used on the normal path
+  G4int Z = G4lrint(elm->GetZ());
+  for (G4int j = nDataSetList-1; j >= 0; --j) { 
+    if (dataSetList[j]->IsElementApplicable(part, Z, mat)) { return true; }
+  }
+  G4int nIso = elm->GetNumberOfIsotopes();
+  if(0 >= nIso) { return false; }
+  G4IsotopeVector* isoVector = elm->GetIsotopeVector();
+  for (G4int i = 0; i<nIso; ++i) {
+    G4int A = (*isoVector)[i]->GetN();
+    G4bool yes = false;
+    for (G4int j = nDataSetList-1; j >= 0; --j) { 
+      if (dataSetList[j]->IsIsoApplicable(part, Z, A, elm, mat)) { 
+	yes = true;
+	break; 
+      }
+    }
+    if(!yes) { return false; }
+  }
+  return true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void G4CrossSectionDataStore::SetCrossSectionTableLimits(G4double emin,
+							 G4double emax,
+							 G4int nbins)
+{
+  if(emin > 0.0 && emax > emin && nbins > 0) {
+    tableEmin = emin;
+    tableEmax = emax;
+    tableBinsPerDecade = nbins;
+  } else {
+    G4ExceptionDescription ed;
+    ed << "Wrong limits Emin(MeV)= " << emin/MeV << " Emax(MeV)= "
+       << emax/MeV << " Nbins/decade= " << nbins << " are ignored";
+    G4Exception("G4CrossSectionDataStore::SetCrossSectionTableLimits", 
+		"had001", JustWarning, ed);
+  }
+}
+
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
 void G4CrossSectionDataStore::ActivateFastPath( const G4ParticleDefinition* pdef, const G4Material* mat, G4double min_cutoff)
@@ -38,6 +38,7 @@
 // Creation date: 09.05.2008
 //
 // Modifications:
+// 19.10.2026 access to per material cross section tables and counters
 //
 //
 // Class Description:
@@ -205,6 +206,22 @@ public:
 
   void SetProcessRelLevel(G4double relativeLevel);
 
+  // Precomputed per material cross section tables, should be
+  // enabled before initialisation on the master thread; options are
+  // passed to the cross section data stores of the registered processes
+  void SetCrossSectionTables(G4bool val);
+
+  void SetCrossSectionTableLimits(G4double emin, G4double emax,
+                                  G4int nbinsPerDecade);
+
+  // Number of cross section computations done with/without tables
+  // by all hadronic processes of the thread
+  G4long GetNumberOfTableHits() const;
+
+  G4long GetNumberOfTableMisses() const;
+
+  void PrintCrossSectionTableStatistics() const;
+
 private:
 
   // constructor
@@ -244,6 +261,12 @@ private:
   G4int  verbose;
   G4bool buildTableStart;
 
+  // options of per material cross section tables
+  G4bool   xsTables;
+  G4double xsTableEmin;
+  G4double xsTableEmax;
+  G4int    xsTableBinsPerDecade;
+
   // cache
   HP   currentProcess;
   PD   currentParticle;
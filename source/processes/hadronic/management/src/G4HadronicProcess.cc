@@ -210,7 +210,12 @@ void G4HadronicProcess::BuildPhysicsTable(const G4ParticleDefinition& p)
 {
   try
   {
-    theCrossSectionDataStore->BuildPhysicsTable(p);
+    // in worker threads per material cross section tables are 
+    // shared with the master process
+    const G4HadronicProcess* masterProc = 
+      static_cast<const G4HadronicProcess*>(GetMasterProcess());
+    theCrossSectionDataStore->BuildPhysicsTable(p, (masterProc) ? 
+      masterProc->theCrossSectionDataStore : nullptr);
     theEnergyRangeManager.BuildPhysicsTable(p);
   }
   catch(G4HadronicException aR)
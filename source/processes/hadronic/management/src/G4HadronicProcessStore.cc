@@ -79,6 +79,9 @@ G4HadronicProcessStore* G4HadronicProcessStore::Instance()
 
 G4HadronicProcessStore::~G4HadronicProcessStore()
 {
+  if(1 < verbose && xsTables) {
+    PrintCrossSectionTableStatistics();
+  }
   Clean();
   delete theEPTestMessenger;
 }
@@ -124,6 +127,10 @@ G4HadronicProcessStore::G4HadronicProcessStore()
     G4ParticleTable::GetParticleTable()->FindParticle("GenericIon");
   verbose = 1;
   buildTableStart = true;
+  xsTables = false;
+  xsTableEmin = 20*MeV;
+  xsTableEmax = 100*TeV;
+  xsTableBinsPerDecade = 20;
   theEPTestMessenger = new G4HadronicEPTestMessenger(this);
 }
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
@@ -416,6 +423,10 @@ void G4HadronicProcessStore::Register(G4HadronicProcess* proc)
   }
   ++n_proc;
   process.push_back(proc);
+  G4CrossSectionDataStore* csds = proc->GetCrossSectionDataStore();
+  csds->SetCrossSectionTables(xsTables);
+  csds->SetCrossSectionTableLimits(xsTableEmin, xsTableEmax, 
+                                   xsTableBinsPerDecade);
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
@@ -950,3 +961,89 @@ void G4HadronicProcessStore::SetProcessRelLevel(G4double rellevel)
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void G4HadronicProcessStore::SetCrossSectionTables(G4bool val)
+{
+  xsTables = val;
+  for (G4int i=0; i<n_proc; ++i) {
+    if(process[i]) { 
+      process[i]->GetCrossSectionDataStore()->SetCrossSectionTables(val); 
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void G4HadronicProcessStore::SetCrossSectionTableLimits(G4double emin,
+                                                        G4double emax,
+                                                        G4int nbins)
+{
+  if(emin > 0.0 && emax > emin && nbins > 0) {
+    xsTableEmin = emin;
+    xsTableEmax = emax;
+    xsTableBinsPerDecade = nbins;
+    for (G4int i=0; i<n_proc; ++i) {
+      if(process[i]) { 
+        process[i]->GetCrossSectionDataStore()
+          ->SetCrossSectionTableLimits(emin, emax, nbins); 
+      }
+    }
+  } else {
+    G4ExceptionDescription ed;
+    ed << "Wrong limits Emin(MeV)= " << emin/MeV << " Emax(MeV)= "
+       << emax/MeV << " Nbins/decade= " << nbins << " are ignored";
+    G4Exception("G4HadronicProcessStore::SetCrossSectionTableLimits", 
+                "had001", JustWarning, ed);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+G4long G4HadronicProcessStore::GetNumberOfTableHits() const
+{
+  G4long n = 0;
+  for (G4int i=0; i<n_proc; ++i) {
+    if(process[i]) { 
+      n += process[i]->GetCrossSectionDataStore()->GetNumberOfTableHits(); 
+    }
+  }
+  return n;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+G4long G4HadronicProcessStore::GetNumberOfTableMisses() const
+{
+  G4long n = 0;
+  for (G4int i=0; i<n_proc; ++i) {
+    if(process[i]) { 
+      n += process[i]->GetCrossSectionDataStore()->GetNumberOfTableMisses(); 
+    }
+  }
+  return n;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void G4HadronicProcessStore::PrintCrossSectionTableStatistics() const
+{
+  G4cout << "\n====================================================================\n"
+         << std::setw(60) << "HADRONIC CROSS SECTION TABLES: hits/misses" 
+         << G4endl;
+  for (G4int i=0; i<n_proc; ++i) {
+    if(!process[i]) { continue; }
+    const G4CrossSectionDataStore* csds = 
+      process[i]->GetCrossSectionDataStore();
+    if(!csds->HasCrossSectionTables()) { continue; }
+    G4cout << std::setw(30) << process[i]->GetProcessName() 
+           << std::setw(14) << csds->GetNumberOfTableHits() 
+           << std::setw(14) << csds->GetNumberOfTableMisses() << G4endl;
+  }
+  G4cout << std::setw(30) << "Total" 
+         << std::setw(14) << GetNumberOfTableHits() 
+         << std::setw(14) << GetNumberOfTableMisses() 
+         << "\n================================================================"
+         << G4endl;
+}
@@ -37,6 +37,8 @@
 //
 //      Creation date: 8 June 2000
 //
+//      19.10.2026 added counters of calls and of allocations per call
+//
 // -----------------------------------------------------------------------------
 
 #ifndef G4BinaryCascade_hh
@@ -83,6 +85,14 @@ public:
   virtual void ModelDescription(std::ostream&) const;
   virtual void PropagateModelDescription(std::ostream&) const;
 
+  // statistics of this model: number of cascades run by ApplyYourself
+  // and number of G4KineticTrack, G4ReactionProduct and G4Fragment
+  // objects allocated inside these calls
+  inline G4long GetNumberOfCalls() const;
+  inline G4long GetNumberOfKineticTrackAllocations() const;
+  inline G4long GetNumberOfReactionProductAllocations() const;
+  inline G4long GetNumberOfFragmentAllocations() const;
+
 private:
 
   G4BinaryCascade(const G4BinaryCascade & right);
@@ -215,10 +225,34 @@ private:
   const G4ParticleDefinition * thePrimaryType;
   G4ThreeVector theMomentumTransfer;
 
+  G4long nCalls;
+  G4long nKTAllocations;
+  G4long nRPAllocations;
+  G4long nFragAllocations;
 
 
 };
 
+inline G4long G4BinaryCascade::GetNumberOfCalls() const
+{
+  return nCalls;
+}
+
+inline G4long G4BinaryCascade::GetNumberOfKineticTrackAllocations() const
+{
+  return nKTAllocations;
+}
+
+inline G4long G4BinaryCascade::GetNumberOfReactionProductAllocations() const
+{
+  return nRPAllocations;
+}
+
+inline G4long G4BinaryCascade::GetNumberOfFragmentAllocations() const
+{
+  return nFragAllocations;
+}
+
 #endif
 
 
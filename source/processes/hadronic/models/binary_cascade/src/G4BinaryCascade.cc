@@ -160,6 +160,7 @@ G4VIntraNuclearTransportModel("Binary Cascade", ptr)
     currentInitialEnergy=initial_nuclear_mass=0.;
     massInNucleus=0.;
     theOuterRadius=0.;
+    nCalls=nKTAllocations=nRPAllocations=nFragAllocations=0;
 }
 
 /*
@@ -171,6 +172,15 @@ G4BinaryCascade::G4BinaryCascade(const G4BinaryCascade& )
 
 G4BinaryCascade::~G4BinaryCascade()
 {
+    if(GetVerboseLevel() > 1 && nCalls > 0)
+    {
+        G4double norm = 1.0/G4double(nCalls);
+        G4cout << "### G4BinaryCascade " << this << ": " << nCalls
+               << " calls; allocations per call: G4KineticTrack "
+               << nKTAllocations*norm << ", G4ReactionProduct "
+               << nRPAllocations*norm << ", G4Fragment "
+               << nFragAllocations*norm << G4endl;
+    }
     ClearAndDestroy(&theTargetList);
     ClearAndDestroy(&theSecondaryList);
     ClearAndDestroy(&theCapturedList);
@@ -265,6 +275,11 @@ G4HadFinalState * G4BinaryCascade::ApplyYourself(const G4HadProjectile & aTrack,
         return theDeExcitation->ApplyYourself(aTrack, aNucleus);
     }
 
+    ++nCalls;
+    G4long nKT0 = G4KineticTrack::GetNumberOfAllocations();
+    G4long nRP0 = G4ReactionProduct::GetNumberOfAllocations();
+    G4long nFrag0 = G4Fragment::GetNumberOfAllocations();
+
     theParticleChange.Clear();
     // initialize the G4V3DNucleus from G4Nucleus
     the3DNucleus = new G4Fancy3DNucleus;
@@ -371,6 +386,10 @@ G4HadFinalState * G4BinaryCascade::ApplyYourself(const G4HadProjectile & aTrack,
     delete the3DNucleus;
     the3DNucleus = NULL;
 
+    nKTAllocations += G4KineticTrack::GetNumberOfAllocations() - nKT0;
+    nRPAllocations += G4ReactionProduct::GetNumberOfAllocations() - nRP0;
+    nFragAllocations += G4Fragment::GetNumberOfAllocations() - nFrag0;
+
     if(getenv("BCDEBUG") ) G4cerr << " ######### Binary Cascade Reaction ends ######### "<< G4endl;
 
     return &theParticleChange;
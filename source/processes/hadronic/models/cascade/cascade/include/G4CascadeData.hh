@@ -40,6 +40,8 @@
 // 20110719  M. Kelsey -- Add ctor argument for two-body initial state
 // 20110725  M. Kelsey -- Save initial state as data member
 // 20110923  M. Kelsey -- Add optional ostream& argument to print() fns
+// 20261019  Add running sums of channel and multiplicity cross-sections,
+//		for sampling without per-call buffers.
 
 #ifndef G4_CASCADE_DATA_HH
 #define G4_CASCADE_DATA_HH
@@ -78,6 +80,11 @@ struct G4CascadeData
 
   G4double inelastic[NE];		// Sum of only inelastic channels
 
+  // Running sums used by G4CascadeSampler; cumulative[] restarts at each
+  // multiplicity, so cumulative[index[m+1]-1] == multiplicities[m]
+  G4double cumulative[NXS][NE];
+  G4double cumMultiplicities[NM][NE];
+
   static const G4int empty8bfs[1][8];	// For multiplicity==7 case
   static const G4int empty9bfs[1][9];
 
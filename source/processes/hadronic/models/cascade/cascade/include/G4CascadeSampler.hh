@@ -31,6 +31,7 @@
 //		binning, as base to new sampler.
 // 20100803  M. Kelsey -- Add print function for debugging.
 // 20110923  M. Kelsey -- Add optional ostream& argument to print()
+// 20261019  Add sampling from precomputed running sums, without buffers
 
 #ifndef G4_CASCADE_SAMPLER_HH
 #define G4_CASCADE_SAMPLER_HH
@@ -60,9 +61,21 @@ public:
   findFinalStateIndex(G4int mult, G4double ke, const G4int index[],
 		      const G4double xsec[][energyBins]) const;
 
+  // Same as above, using running sums from G4CascadeData (cumMultiplicities
+  // and cumulative); channel index is relative to start of multiplicity
+  virtual G4int 
+  sampleMultiplicity(G4double ke, const G4double cumMult[][energyBins]) const;
+
+  virtual G4int 
+  sampleFinalStateIndex(G4int mult, G4double ke, const G4int index[],
+			const G4double cumXsec[][energyBins]) const;
+
   virtual void print(std::ostream& os) const;
 
 private:
+  G4int sampleCumulative(G4double ke, const G4double cum[][energyBins],
+			 G4int startBin, G4int stopBin) const;
+
   // Optional start/stop arguments default to inclusive arrays
   void fillSigmaBuffer(G4double ke, const G4double x[][energyBins],
 		       G4int startBin=0, G4int stopBin=multBins) const;
@@ -64,6 +64,7 @@
 // 20130304  M. Kelsey -- Add new G4CascadeHistory for cacasde structure reporting
 // 20130620  Address Coverity complaint about missing copy actions
 // 20141204  M. Kelsey -- Add function to test for non-interacting particles
+// 20261019  Add buffer for ion-ion initial state, reused between cascades
 
 #ifndef G4INTRA_NUCLEI_CASCADER_HH
 #define G4INTRA_NUCLEI_CASCADER_HH
@@ -71,6 +72,7 @@
 #include "G4CascadeColliderBase.hh"
 #include "G4CollisionOutput.hh"
 #include "G4ThreeVector.hh"
+#include <utility>
 #include <vector>
 
 class G4CascadParticle;
@@ -158,6 +160,10 @@ private:
   G4CollisionOutput output;
   std::vector<G4CascadParticle> cascad_particles;
   std::vector<G4CascadParticle> new_cascad_particles;
+
+  // Ion-ion initial state (same type as G4NucleiModel::modelLists)
+  std::pair<std::vector<G4CascadParticle>,
+	    std::vector<G4InuclElementaryParticle> > modelParticles;
   G4ExitonConfiguration theExitonConfiguration;
 
   std::vector<G4ThreeVector> hitNucleons;	// Nucleons hit before rescatter
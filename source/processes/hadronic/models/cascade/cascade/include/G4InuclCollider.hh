@@ -42,12 +42,15 @@
 // 20110308  M. Kelsey -- Add ::deexcite() function to handle nuclear fragment
 // 20130620  Address Coverity complaint about missing copy actions
 // 20150128  Add function to check for sensible photonuclear final states
+// 20261019  Add local buffers for realigned bullet, to avoid new/delete
 
 #ifndef G4INUCL_COLLIDER_HH
 #define G4INUCL_COLLIDER_HH
 
 #include "G4CascadeColliderBase.hh"
 #include "G4CollisionOutput.hh"
+#include "G4InuclElementaryParticle.hh"
+#include "G4InuclNuclei.hh"
 
 class G4CascadParticle;
 class G4ElementaryParticleCollider;
@@ -91,6 +94,9 @@ private:
   G4CollisionOutput output;		// Secondaries from main cascade
   G4CollisionOutput DEXoutput;		// Secondaries from de-excitation
 
+  G4InuclElementaryParticle hadronBullet;	// Buffers for realigned bullet
+  G4InuclNuclei             nucleusBullet;
+
 private:
   // Copying of modules is forbidden
   G4InuclCollider(const G4InuclCollider&);
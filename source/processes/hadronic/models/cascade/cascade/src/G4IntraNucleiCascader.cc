@@ -119,6 +119,7 @@
 //		move those directly to output without propagating
 // 20150608  M. Kelsey -- Label all while loops as terminating.
 // 20150619  M. Kelsey -- Replace std::exp with G4Exp
+// 20261019  Use member buffer for ion-ion initial state in setupCascade()
 
 #include <algorithm>
 
@@ -333,11 +334,10 @@ void G4IntraNucleiCascader::setupCascade() {
     G4int ab = bnuclei->getA();
     G4int zb = bnuclei->getZ();
     
-    G4NucleiModel::modelLists all_particles;    // Buffer to receive lists
-    model->initializeCascad(bnuclei, tnuclei, all_particles);
+    model->initializeCascad(bnuclei, tnuclei, modelParticles);
     
-    cascad_particles = all_particles.first;
-    output.addOutgoingParticles(all_particles.second);
+    cascad_particles = modelParticles.first;
+    output.addOutgoingParticles(modelParticles.second);
     
     if (cascad_particles.size() == 0) { // compound nuclei
       G4int i;
@@ -34,6 +34,7 @@
 // 17-11-2010 V.Ivanchenko in constructor replace G4VEmissionProbability by 
 //            G4EvaporationProbability and do not new and delete probability
 //            object at each call; use G4Pow
+// 19-10-2026 optional tables of emission probability per fragment
 
 #ifndef G4EvaporationChannel_h
 #define G4EvaporationChannel_h 1
@@ -41,6 +42,8 @@
 #include "G4VEvaporationChannel.hh"
 #include "G4EvaporationProbability.hh"
 #include "G4VCoulombBarrier.hh"
+#include <vector>
+#include <map>
 
 class G4PairingCorrection;
 
@@ -62,6 +65,36 @@ public:
   virtual G4Fragment* EmittedFragment(G4Fragment* theNucleus);
 
 private: 
+
+  // Emission probability and maximum of the distribution function 
+  // for a given fragment on a grid uniform in sqrt(U)
+  struct ProbabilityTable {
+    G4double invStep;
+    std::vector<G4double> logProb;
+    std::vector<G4double> probMax;
+  };
+
+  // Shared tables are identified by the channel, the decaying fragment
+  // and the parameters the probabilities depend on
+  struct TableKey {
+    G4int fragment;
+    G4int optxs;
+    G4double levelDensity;
+    inline G4bool operator<(const TableKey& k) const {
+      if(fragment != k.fragment) { return fragment < k.fragment; }
+      if(optxs != k.optxs) { return optxs < k.optxs; }
+      return levelDensity < k.levelDensity;
+    }
+  };
+
+  G4bool ComputeLimits(G4Fragment* fragment);
+
+  const ProbabilityTable* FindTable(G4int FragZ, G4int FragA);
+
+  void BuildTable(G4int FragZ, G4int FragA, ProbabilityTable&);
+
+  G4bool Interpolate(const ProbabilityTable*, G4double U, 
+		     G4double& prob, G4double& pmax) const;
   
   G4EvaporationChannel(const G4EvaporationChannel & right) = delete;
   const G4EvaporationChannel & operator=
@@ -108,6 +141,15 @@ private:
   G4double MinKinEnergy;
   G4double MaxKinEnergy;
 
+  // Tables of probabilities are shared between threads, 
+  // the local map keeps pointers to tables already found
+  // with the parameters of the last initialisation
+  G4bool fUseTables;
+  G4int fOPTxs;
+  G4double fLevelDensity;
+  std::map<G4int, const ProbabilityTable*> fTables;
+  static std::map<TableKey, ProbabilityTable> fSharedTables;
+
 };
 
 
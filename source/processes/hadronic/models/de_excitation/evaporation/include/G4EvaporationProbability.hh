@@ -63,6 +63,13 @@ public:
 			    G4double maxKineticEnergy,
 			    G4double CoulombBarrier = 0.0);
 
+  // Initialises the fragment for sampling with the probability and 
+  // the maximum of distribution function obtained from a table
+  G4double TabulatedProbability(const G4Fragment& fragment,
+				G4double probability, G4double pmax);
+
+  inline G4double GetProbMax() const { return probmax; }
+
   G4double ProbabilityDistributionFunction(G4double K, 
 					   G4double CoulombBarrier = 0.0);
 
@@ -80,6 +87,8 @@ protected:
 
 private:
 
+  void InitialiseFragment(const G4Fragment& fragment);
+
   G4double IntegrateEmissionProbability(G4double low, G4double up,
 					G4double CoulombBarrier);
 
@@ -37,6 +37,7 @@
 // 17-11-2010 V.Ivanchenko in constructor replace G4VEmissionProbability by 
 //            G4EvaporationProbability and do not new and delete probability
 //            object at each call; use G4Pow
+// 19-10-2026 optional tables of emission probability per fragment
 
 #include "G4EvaporationChannel.hh"
 #include "G4PairingCorrection.hh"
@@ -49,6 +50,21 @@
 #include "Randomize.hh"
 #include "G4RandomDirection.hh"
 #include "G4Alpha.hh"
+#include "G4NuclearLevelData.hh"
+#include "G4DeexPrecoParameters.hh"
+#include "G4AutoLock.hh"
+
+namespace
+{
+  G4Mutex evaporationChannelMutex = G4MUTEX_INITIALIZER;
+
+  // grid of tables: excitation from 0 to 3 MeV per nucleon 
+  const G4int    nTableBins = 100;
+  const G4double maxTableExPerNucleon = 3.0*CLHEP::MeV;
+}
+
+std::map<G4EvaporationChannel::TableKey, G4EvaporationChannel::ProbabilityTable> 
+G4EvaporationChannel::fSharedTables;
 
 G4EvaporationChannel::G4EvaporationChannel(G4int anA, G4int aZ, 
 					   const G4String & aName,
@@ -62,6 +78,9 @@ G4EvaporationChannel::G4EvaporationChannel(G4int anA, G4int aZ,
 { 
   ResA = ResZ = 0;
   Mass = CoulombBarrier = MinKinEnergy = MaxKinEnergy = EmissionProbability = 0.0; 
+  fUseTables = false;
+  fOPTxs = 0;
+  fLevelDensity = 0.0;
   EvapMass = G4NucleiProperties::GetNuclearMass(theA, theZ);
   pairingCorrection = G4PairingCorrection::GetInstance();
 }
@@ -73,9 +92,45 @@ void G4EvaporationChannel::Initialise()
 {
   theProbability->Initialise();
   G4VEvaporationChannel::Initialise();  
+  G4DeexPrecoParameters* param = 
+    G4NuclearLevelData::GetInstance()->GetParameters();
+  fUseTables = param->UseEvaporationTables() && 
+    0 < param->GetDeexModelType();
+
+  // tables found before are not valid if the parameters have changed
+  if(fOPTxs != param->GetDeexModelType() || 
+     fLevelDensity != param->GetLevelDensity()) {
+    fOPTxs = param->GetDeexModelType();
+    fLevelDensity = param->GetLevelDensity();
+    fTables.clear();
+  }
 }
 
 G4double G4EvaporationChannel::GetEmissionProbability(G4Fragment* fragment)
+{
+  // the table should be found before the limits are computed, 
+  // because the building of a table changes data members
+  const ProbabilityTable* table = (fUseTables) ?
+    FindTable(fragment->GetZ_asInt(), fragment->GetA_asInt()) : nullptr;
+
+  EmissionProbability = 0.0;
+  if(ComputeLimits(fragment)) {
+    G4double prob, pmax;
+    if(table && Interpolate(table, fragment->GetExcitationEnergy(), 
+			    prob, pmax)) {
+      EmissionProbability = 
+	theProbability->TabulatedProbability(*fragment, prob, pmax);
+    } else {
+      EmissionProbability = theProbability->
+	TotalProbability(*fragment, MinKinEnergy, MaxKinEnergy, CoulombBarrier);
+    }
+  }
+  //G4cout << "G4EvaporationChannel:: probability= " 
+  //    << EmissionProbability << G4endl;   
+  return EmissionProbability;
+}
+
+G4bool G4EvaporationChannel::ComputeLimits(G4Fragment* fragment)
 {
   G4int FragA = fragment->GetA_asInt();
   G4int FragZ = fragment->GetZ_asInt();
@@ -87,7 +142,6 @@ G4double G4EvaporationChannel::GetEmissionProbability(G4Fragment* fragment)
   Mass = FragmentMass + ExEnergy;
   //G4cout << "G4EvaporationChannel::Initialize Z= " << theZ << " A= " << theA 
   //	 << " FragZ= " << FragZ << " FragA= " << FragA << G4endl;
-  EmissionProbability = 0.0;
 
   // Only channels which are physically allowed are taken into account 
   if (ResA >= ResZ && ResZ > 0 && ResA >= theA) {
@@ -118,13 +172,78 @@ G4double G4EvaporationChannel::GetEmissionProbability(G4Fragment* fragment)
       MaxKinEnergy = std::max(0.5*(xm2 - ResMass*ResMass)/Mass, 0.0);
       //G4cout << "Emin= " << MinKinEnergy << " Emax= " << MaxKinEnergy 
       //     << "  xm= " << xm  << G4endl;
-      EmissionProbability = theProbability->
-	TotalProbability(*fragment, MinKinEnergy, MaxKinEnergy, CoulombBarrier);
+      return true;
     }
   }
-  //G4cout << "G4EvaporationChannel:: probability= " 
-  //    << EmissionProbability << G4endl;   
-  return EmissionProbability;
+  return false;
+}
+
+const G4EvaporationChannel::ProbabilityTable* 
+G4EvaporationChannel::FindTable(G4int FragZ, G4int FragA)
+{
+  G4int key = ((theZ*10 + theA)*1000 + FragZ)*1000 + FragA;
+  std::map<G4int, const ProbabilityTable*>::const_iterator it = 
+    fTables.find(key);
+  if(it != fTables.end()) { return it->second; }
+
+  TableKey sharedKey = { key, fOPTxs, fLevelDensity };
+  const ProbabilityTable* table = nullptr;
+  {
+    G4AutoLock l(&evaporationChannelMutex);
+    std::map<TableKey, ProbabilityTable>::const_iterator itr = 
+      fSharedTables.find(sharedKey);
+    if(itr != fSharedTables.end()) { table = &(itr->second); }
+  }
+  if(!table) {
+    // the table is built outside the lock, if another thread has 
+    // built the same table meanwhile its version is used
+    ProbabilityTable newTable;
+    BuildTable(FragZ, FragA, newTable);
+    G4AutoLock l(&evaporationChannelMutex);
+    table = &(fSharedTables.insert(std::make_pair(sharedKey, newTable))
+	      .first->second);
+  }
+  fTables[key] = table;
+  return table;
+}
+
+void G4EvaporationChannel::BuildTable(G4int FragZ, G4int FragA, 
+				      ProbabilityTable& table)
+{
+  G4double xmax = std::sqrt(maxTableExPerNucleon*FragA);
+  table.invStep = nTableBins/xmax;
+  table.logProb.resize(nTableBins + 1, 0.0);
+  table.probMax.resize(nTableBins + 1, 0.0);
+  G4double gsMass = G4NucleiProperties::GetNuclearMass(FragA, FragZ);
+  for(G4int i=0; i<=nTableBins; ++i) {
+    G4double x = i*xmax/nTableBins;
+    G4Fragment frag(FragA, FragZ, G4LorentzVector(0.0,0.0,0.0,gsMass + x*x));
+    G4double prob = 0.0;
+    if(ComputeLimits(&frag)) {
+      prob = theProbability->TotalProbability(frag, MinKinEnergy, 
+					      MaxKinEnergy, CoulombBarrier);
+    }
+    // zero probability is marked by zero maximum of distribution
+    if(prob > 0.0) {
+      table.logProb[i] = G4Log(prob);
+      table.probMax[i] = theProbability->GetProbMax();
+    }
+  }
+}
+
+G4bool G4EvaporationChannel::Interpolate(const ProbabilityTable* table, 
+					 G4double U, G4double& prob, 
+					 G4double& pmax) const
+{
+  // near thresholds probabilities are not interpolated
+  G4double x = std::sqrt(std::max(U, 0.0))*table->invStep;
+  G4int i = (G4int)x;
+  if(i >= nTableBins || 0.0 == table->probMax[i] || 
+     0.0 == table->probMax[i+1]) { return false; }
+  x -= i;
+  prob = G4Exp((1.0 - x)*table->logProb[i] + x*table->logProb[i+1]);
+  pmax = std::max(table->probMax[i], table->probMax[i+1]);
+  return true;
 }
 
 G4Fragment* G4EvaporationChannel::EmittedFragment(G4Fragment* theNucleus)
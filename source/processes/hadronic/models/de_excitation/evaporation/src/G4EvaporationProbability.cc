@@ -36,6 +36,8 @@
 // JMQ (14 february 2009) bug fixed in emission width: hbarc instead of 
 //                        hbar_Planck in the denominator
 //
+// 19.10.2026 added TabulatedProbability used with tables of probabilities
+//
 #include "G4EvaporationProbability.hh"
 #include "G4NuclearLevelData.hh"
 #include "G4VCoulombBarrier.hh"
@@ -79,9 +81,7 @@ G4double G4EvaporationProbability::EmissionProbability(
   return 0.0;
 }
 
-G4double G4EvaporationProbability::TotalProbability(
-  const G4Fragment & fragment, G4double minEnergy, G4double maxEnergy, 
-  G4double CoulombBarrier)
+void G4EvaporationProbability::InitialiseFragment(const G4Fragment & fragment)
 {
   fragA = fragment.GetA_asInt();
   fragZ = fragment.GetZ_asInt();
@@ -96,6 +96,27 @@ G4double G4EvaporationProbability::TotalProbability(
   resMass = G4NucleiProperties::GetNuclearMass(resA, resZ);
   resA13 = fG4pow->Z13(resA);
   a0 = LevelDensity*fragA;
+}
+
+G4double G4EvaporationProbability::TabulatedProbability(
+  const G4Fragment & fragment, G4double prob, G4double pmax)
+{
+  InitialiseFragment(fragment);
+  if(U < delta0 || prob <= 0.0) { return 0.0; }
+  if(OPTxs <= 2) { 
+    muu =  G4ChatterjeeCrossSection::ComputePowerParameter(resA, index);
+  } else {
+    muu = G4KalbachCrossSection::ComputePowerParameter(resA, index);
+  }
+  probmax = pmax;
+  return prob;
+}
+
+G4double G4EvaporationProbability::TotalProbability(
+  const G4Fragment & fragment, G4double minEnergy, G4double maxEnergy, 
+  G4double CoulombBarrier)
+{
+  InitialiseFragment(fragment);
   /*    
   G4cout << "G4EvaporationProbability: resZ= " << resZ << " resA= " << resA 
 	 << " fragZ= " << fragZ << " fragA= " << fragA << " U= " 
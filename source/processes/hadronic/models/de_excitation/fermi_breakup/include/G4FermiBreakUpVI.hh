@@ -28,6 +28,8 @@
 // FermiBreakUp de-excitation model
 // by V. Ivanchenko (July 2016)
 //
+// 19.10.2026 added counters of calls and of fragment allocations
+//
 
 #ifndef G4FermiBreakUpVI_h
 #define G4FermiBreakUpVI_h 1
@@ -61,6 +63,11 @@ public:
   // primary fragment is deleted or is modified and added to the list
   // of products 
   virtual void BreakFragment(G4FragmentVector*, G4Fragment* theNucleus) final;
+
+  // statistics of this model: number of calls to BreakFragment and 
+  // number of G4Fragment objects allocated inside these calls
+  inline G4long GetNumberOfCalls() const;
+  inline G4long GetNumberOfFragmentAllocations() const;
   
 private:
 
@@ -78,6 +85,9 @@ private:
 
   CLHEP::HepRandomEngine* rndmEngine;
 
+  G4long nCalls;
+  G4long nFragAllocations;
+
   G4int verbose;
   G4int maxZ;
   G4int maxA;
@@ -106,4 +116,14 @@ private:
 #endif
 };
 
+inline G4long G4FermiBreakUpVI::GetNumberOfCalls() const
+{
+  return nCalls;
+}
+
+inline G4long G4FermiBreakUpVI::GetNumberOfFragmentAllocations() const
+{
+  return nFragAllocations;
+}
+
 #endif
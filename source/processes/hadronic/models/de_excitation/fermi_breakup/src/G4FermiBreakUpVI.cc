@@ -28,6 +28,8 @@
 // FermiBreakUp de-excitation model
 // by V. Ivanchenko (July 2016)
 //
+// 19.10.2026 added counters of calls and of fragment allocations
+//
 
 #include "G4FermiBreakUpVI.hh"
 #include "G4FermiFragmentsPoolVI.hh"
@@ -45,7 +47,8 @@ G4Mutex G4FermiBreakUpVI::FermiBreakUpVIMutex = G4MUTEX_INITIALIZER;
 #endif
 
 G4FermiBreakUpVI::G4FermiBreakUpVI() 
-  : theDecay(nullptr), rndmEngine(nullptr), verbose(0), maxZ(9), maxA(17)
+  : theDecay(nullptr), rndmEngine(nullptr), nCalls(0), nFragAllocations(0),
+    verbose(0), maxZ(9), maxA(17)
 {
   prob.reserve(10);
   frag.reserve(10);
@@ -58,6 +61,12 @@ G4FermiBreakUpVI::G4FermiBreakUpVI()
 
 G4FermiBreakUpVI::~G4FermiBreakUpVI()
 {
+  if(verbose > 1 && nCalls > 0) {
+    G4cout << "### G4FermiBreakUpVI " << this << ": " << nCalls 
+	   << " calls, " << nFragAllocations << " fragments allocated ("
+	   << G4double(nFragAllocations)/G4double(nCalls) << " per call)"
+	   << G4endl;
+  }
   if(G4Threading::IsMasterThread()) { 
     delete thePool;
     thePool = nullptr;
@@ -97,6 +106,7 @@ void G4FermiBreakUpVI::BreakFragment(G4FragmentVector* theResult,
     G4cout << "### G4FermiBreakUpVI::BreakFragment start new fragment " << G4endl;
     G4cout << *theNucleus << G4endl;
   }
+  ++nCalls;
   frag.clear();
   lvect.clear();
 
@@ -137,6 +147,7 @@ void G4FermiBreakUpVI::BreakFragment(G4FragmentVector* theResult,
     if(!SampleDecay()) {
       if(verbose > 0) { G4cout << "   New G4Fragment" << G4endl; }
       G4Fragment* f = new G4Fragment(A, Z, lv0);
+      ++nFragAllocations;
       f->SetSpin(0.5*spin);
       f->SetCreationTime(time);
       theResult->push_back(f);
@@ -44,6 +44,7 @@
 //    superimposed Coulomb barrier (if useSICBis set true, by default is false)  
 // 23 January 2012 by V.Ivanchenko remove obsolete data members; added access
 //    methods to deexcitation components
+// 19.10.2026 added counters of calls and of fragment allocations
 //                   
 
 #ifndef G4ExcitationHandler_h
@@ -83,6 +84,11 @@ public:
   void SetPhotonEvaporation(G4VEvaporationChannel* ptr);
   void SetDeexChannelsType(G4DeexChannelType val);
 
+  // statistics of this handler: number of calls to BreakItUp and 
+  // number of G4Fragment objects allocated inside these calls
+  inline G4long GetNumberOfCalls() const;
+  inline G4long GetNumberOfFragmentAllocations() const;
+
   //======== Obsolete methods to be removed =====
 
   // parameters of sub-models
@@ -127,6 +133,9 @@ private:
   G4IonTable* theTableOfIons;
   G4NistManager* nist;
 
+  G4long nCalls;
+  G4long nFragAllocations;
+
   G4int  fVerbose;
   G4bool isInitialised;
   G4bool isEvapLocal;
@@ -191,4 +200,14 @@ inline void G4ExcitationHandler::SetOPTxs(G4int)
 inline void G4ExcitationHandler::UseSICB()
 {}
 
+inline G4long G4ExcitationHandler::GetNumberOfCalls() const
+{
+  return nCalls;
+}
+
+inline G4long G4ExcitationHandler::GetNumberOfFragmentAllocations() const
+{
+  return nFragAllocations;
+}
+
 #endif
@@ -84,6 +84,7 @@
 
 G4ExcitationHandler::G4ExcitationHandler()
   : maxZForFermiBreakUp(9),maxAForFermiBreakUp(17),
+    nCalls(0),nFragAllocations(0),
     fVerbose(0),isInitialised(false),isEvapLocal(true)
 {                                                                          
   theTableOfIons = G4ParticleTable::GetParticleTable()->GetIonTable();
@@ -105,6 +106,12 @@ G4ExcitationHandler::G4ExcitationHandler()
 G4ExcitationHandler::~G4ExcitationHandler()
 {
   //G4cout << "### Delete handler " << this << G4endl;
+  if(fVerbose > 1 && nCalls > 0) {
+    G4cout << "### G4ExcitationHandler " << this << ": " << nCalls 
+	   << " calls, " << nFragAllocations << " fragments allocated ("
+	   << G4double(nFragAllocations)/G4double(nCalls) << " per call)"
+	   << G4endl;
+  }
   delete theMultiFragmentation;
   delete theFermiModel;
   if(isEvapLocal) { delete theEvaporation; } 
@@ -201,6 +208,9 @@ void G4ExcitationHandler::SetDeexChannelsType(G4DeexChannelType val)
 G4ReactionProductVector * 
 G4ExcitationHandler::BreakItUp(const G4Fragment & theInitialState)
 {
+  ++nCalls;
+  G4long nAlloc0 = G4Fragment::GetNumberOfAllocations();
+
   // Variables existing until end of method
   G4Fragment * theInitialStatePtr = new G4Fragment(theInitialState);
   if(fVerbose > 1) { 	
@@ -496,6 +506,7 @@ G4ExcitationHandler::BreakItUp(const G4Fragment & theInitialState)
     }
     delete frag;
   }
+  nFragAllocations += G4Fragment::GetNumberOfAllocations() - nAlloc0;
   if(fVerbose > 2) { 	
     G4cout << "@@@@@@@@@@ End G4Excitation Handler "<< G4endl;
   }
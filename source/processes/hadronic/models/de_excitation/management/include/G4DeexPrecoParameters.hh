@@ -88,6 +88,8 @@ public:
 
   inline G4int GetDeexModelType() const;
 
+  inline G4int GetMaxZForLevelUpload() const;
+
   inline G4bool NeverGoBack() const;
 
   inline G4bool UseSoftCutoff() const;
@@ -106,6 +108,8 @@ public:
 
   inline G4bool StoreAllLevels() const;
 
+  inline G4bool UseEvaporationTables() const;
+
   inline G4DeexChannelType GetDeexChannelsType() const;
 
   // Set methods 
@@ -138,6 +142,10 @@ public:
 
   void SetDeexModelType(G4int);
 
+  // nuclear level data for all isotopes with Z <= given value
+  // are uploaded at initialisation 
+  void SetMaxZForLevelUpload(G4int);
+
   void SetNeverGoBack(G4bool);
 
   void SetUseSoftCutoff(G4bool);
@@ -156,6 +164,10 @@ public:
 
   void SetStoreAllLevels(G4bool);
 
+  // light fragment emission probabilities are interpolated from 
+  // tables per fragment built on first use and shared between threads
+  void SetUseEvaporationTables(G4bool);
+
   void SetDeexChannelsType(G4DeexChannelType);
 
 private:
@@ -202,6 +214,9 @@ private:
   G4int fPrecoType;
   G4int fDeexType;
 
+  // Level data upload
+  G4int fMaxZForLevelUpload;
+
   // Preco flags
   G4bool fNeverGoBack;
   G4bool fUseSoftCutoff;
@@ -214,6 +229,7 @@ private:
   G4bool fUseLongFiles;
   G4bool fCorrelatedGamma;
   G4bool fStoreAllLevels;
+  G4bool fEvaporationTables;
 
   // type of a set of e-exitation channels
   G4DeexChannelType fDeexChannelType;   
@@ -328,11 +344,21 @@ inline G4bool G4DeexPrecoParameters::CorrelatedGamma() const
   return fCorrelatedGamma;
 }
 
+inline G4int G4DeexPrecoParameters::GetMaxZForLevelUpload() const
+{
+  return fMaxZForLevelUpload;
+}
+
 inline G4bool G4DeexPrecoParameters::StoreAllLevels() const
 {
   return fStoreAllLevels;
 }
 
+inline G4bool G4DeexPrecoParameters::UseEvaporationTables() const
+{
+  return fEvaporationTables;
+}
+
 inline G4DeexChannelType G4DeexPrecoParameters::GetDeexChannelsType() const
 {
   return fDeexChannelType;
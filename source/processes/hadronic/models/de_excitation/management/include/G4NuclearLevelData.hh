@@ -36,11 +36,14 @@
 //      Creation date: 9 February 2014
 //
 //      Modifications:
-//      
+//      19.10.2026 lock free access to level managers, upload of
+//                 all isotopes up to given Z
 // -------------------------------------------------------------------
 //
 // Nuclear level data uploaded at initialisation of Geant4 from 
-// data files of the G4LEVELGAMMADATA
+// data files of the G4LEVELGAMMADATA; data are shared between 
+// threads, a level manager is created once under the lock,
+// after that access is done without locking
 // 
 
 #ifndef G4NUCLEARLEVELDATA_HH
@@ -50,6 +53,7 @@
 #include "G4DeexPrecoParameters.hh"
 #include "G4Threading.hh"
 #include <vector>
+#include <atomic>
 
 class G4LevelReader;
 class G4LevelManager;
@@ -71,6 +75,10 @@ public:
   // run time call to access or to create level manager
   const G4LevelManager* GetLevelManager(G4int Z, G4int A);
 
+  // upload data for all isotopes with Z from 1 to given value,
+  // should be called from master thread at initialisation
+  void UploadNuclearLevelData(G4int Z);
+
   // add private data to isotope from master thread
   G4bool AddPrivateData(G4int Z, G4int A, const G4String& filename);
 
@@ -99,6 +107,8 @@ private:
 
   void InitialiseForIsotope(G4int Z, G4int A);
 
+  void CreateLevelManager(G4int Z, G4int A);
+
   G4NuclearLevelData(G4NuclearLevelData &) = delete;
   G4NuclearLevelData & operator=(const G4NuclearLevelData &right) = delete;
 
@@ -110,8 +120,10 @@ private:
   static const G4int AMAX[ZMAX];
   static const G4int LEVELIDX[ZMAX];
 
+  // a flag is set after the level manager is created
   std::vector<const G4LevelManager*> fLevelManagers[ZMAX];
-  std::vector<G4bool> fLevelManagerFlags[ZMAX];
+  std::vector<std::atomic<G4bool> > fLevelManagerFlags[ZMAX];
+  std::atomic<G4int> fMaxZUploaded;
 
 #ifdef G4MULTITHREADED
   static G4Mutex nuclearLevelDataMutex;
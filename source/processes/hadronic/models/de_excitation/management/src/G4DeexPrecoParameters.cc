@@ -64,6 +64,7 @@ void G4DeexPrecoParameters::SetDefaults()
   fMinAForPreco = 5;
   fPrecoType = 3;
   fDeexType = 3;
+  fMaxZForLevelUpload = 0;
   fNeverGoBack = false;
   fUseSoftCutoff = false;
   fUseCEM = true;
@@ -73,6 +74,7 @@ void G4DeexPrecoParameters::SetDefaults()
   fUseLongFiles = true;
   fCorrelatedGamma = false;
   fStoreAllLevels = false;
+  fEvaporationTables = false;
   fDeexChannelType = fEvaporation;
 #ifdef G4MULTITHREADED
   G4MUTEXUNLOCK(&G4DeexPrecoParameters::deexPrecoMutex);
@@ -205,12 +207,24 @@ void G4DeexPrecoParameters::SetCorrelatedGamma(G4bool val)
   fCorrelatedGamma = val;
 }
 
+void G4DeexPrecoParameters::SetMaxZForLevelUpload(G4int n)
+{
+  if(IsLocked()) { return; }
+  fMaxZForLevelUpload = n;
+}
+
 void G4DeexPrecoParameters::SetStoreAllLevels(G4bool val)
 {
   if(IsLocked()) { return; }
   fStoreAllLevels = val;
 }
 
+void G4DeexPrecoParameters::SetUseEvaporationTables(G4bool val)
+{
+  if(IsLocked()) { return; }
+  fEvaporationTables = val;
+}
+
 void G4DeexPrecoParameters::SetDeexChannelsType(G4DeexChannelType val)
 {
   if(IsLocked()) { return; }
@@ -234,6 +248,11 @@ std::ostream& G4DeexPrecoParameters::StreamInfo(std::ostream& os) const
   os << "Use new data files                                  " << fUseLongFiles << "\n";
   os << "Use complete data files                             " << fStoreAllLevels << "\n";
   os << "Correlated gamma emission flag                      " << fCorrelatedGamma << "\n";
+  os << "Use tables of evaporation probabilities             " << fEvaporationTables << "\n";
+  if(0 < fMaxZForLevelUpload) {
+    os << "Level data uploaded at initialisation up to Z       " 
+       << fMaxZForLevelUpload << "\n";
+  }
   os << "=======================================================================" << "\n";
   os.precision(prec);
   return os;
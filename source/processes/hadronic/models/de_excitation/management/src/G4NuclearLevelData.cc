@@ -36,7 +36,7 @@
 //      Creation date: 10 February 2015
 //
 //      Modifications:
-//      
+//      19.10.2026 lock free access to level managers
 // -------------------------------------------------------------------
 
 #include "G4NuclearLevelData.hh"
@@ -330,9 +330,13 @@ G4NuclearLevelData::G4NuclearLevelData()
   fDeexPrecoParameters = new G4DeexPrecoParameters();
   fLevelReader = new G4LevelReader(this);
   for(G4int Z=0; Z<ZMAX; ++Z) {
-    (fLevelManagers[Z]).resize(AMAX[Z]-AMIN[Z]+1,nullptr);
-    (fLevelManagerFlags[Z]).resize(AMAX[Z]-AMIN[Z]+1,false);
+    size_t nn = AMAX[Z]-AMIN[Z]+1;
+    (fLevelManagers[Z]).resize(nn,nullptr);
+    std::vector<std::atomic<G4bool> > flags(nn);
+    for(size_t j=0; j<nn; ++j) { flags[j].store(false); }
+    (fLevelManagerFlags[Z]).swap(flags);
   }
+  fMaxZUploaded.store(0);
 #ifdef G4MULTITHREADED
   G4MUTEXUNLOCK(&G4NuclearLevelData::nuclearLevelDataMutex);
 #endif
@@ -358,7 +362,9 @@ G4NuclearLevelData::GetLevelManager(G4int Z, G4int A)
   const G4LevelManager* man = nullptr;
   //G4cout << "G4NuclearLevelData: Z= " << Z << " A= " << A << G4endl;  
   if(0 < Z && Z < ZMAX && A >= AMIN[Z] && A <= AMAX[Z]) {
-    if(!(fLevelManagerFlags[Z])[A - AMIN[Z]]) {
+    // the flag is stored after the level manager, so if it is set 
+    // the manager may be used without locking
+    if(!(fLevelManagerFlags[Z])[A - AMIN[Z]].load(std::memory_order_acquire)) {
       InitialiseForIsotope(Z, A);
     }
     man = (fLevelManagers[Z])[A - AMIN[Z]];
@@ -381,7 +387,7 @@ G4NuclearLevelData::AddPrivateData(G4int Z, G4int A, const G4String& filename)
     if(newman) { 
       delete (fLevelManagers[Z])[A - AMIN[Z]]; 
       (fLevelManagers[Z])[A - AMIN[Z]] = newman;
-      (fLevelManagerFlags[Z])[A - AMIN[Z]] = true;
+      (fLevelManagerFlags[Z])[A - AMIN[Z]].store(true, std::memory_order_release);
       res = true;
     }
   }
@@ -403,18 +409,39 @@ void G4NuclearLevelData::InitialiseForIsotope(G4int Z, G4int A)
 #ifdef G4MULTITHREADED
   G4MUTEXLOCK(&G4NuclearLevelData::nuclearLevelDataMutex);
 #endif
-  if(fDeexPrecoParameters->UseFilesNEW()) {
-    if(!(fLevelManagerFlags[Z])[A - AMIN[Z]]) {
+  CreateLevelManager(Z, A);
+#ifdef G4MULTITHREADED
+  G4MUTEXUNLOCK(&G4NuclearLevelData::nuclearLevelDataMutex);
+#endif
+}
+
+void G4NuclearLevelData::CreateLevelManager(G4int Z, G4int A)
+{
+  // should be called under the lock
+  if(!(fLevelManagerFlags[Z])[A - AMIN[Z]].load(std::memory_order_relaxed)) {
+    if(fDeexPrecoParameters->UseFilesNEW()) {
       (fLevelManagers[Z])[A - AMIN[Z]] = 
 	fLevelReader->CreateLevelManagerNEW(Z, A);
-      (fLevelManagerFlags[Z])[A - AMIN[Z]] = true;
-    }
-  } else {
-    if(!(fLevelManagerFlags[Z])[A - AMIN[Z]]) {
+    } else {
       (fLevelManagers[Z])[A - AMIN[Z]] = 
 	fLevelReader->CreateLevelManager(Z, A);
-      (fLevelManagerFlags[Z])[A - AMIN[Z]] = true;
     }
+    (fLevelManagerFlags[Z])[A - AMIN[Z]].store(true, std::memory_order_release);
+  }
+}
+
+void G4NuclearLevelData::UploadNuclearLevelData(G4int ZZ)
+{
+  G4int Zmax = std::min(ZZ, ZMAX - 1);
+  if(Zmax <= fMaxZUploaded.load(std::memory_order_acquire)) { return; }
+#ifdef G4MULTITHREADED
+  G4MUTEXLOCK(&G4NuclearLevelData::nuclearLevelDataMutex);
+#endif
+  for(G4int Z=fMaxZUploaded.load(std::memory_order_relaxed)+1; Z<=Zmax; ++Z) {
+    for(G4int A=AMIN[Z]; A<=AMAX[Z]; ++A) { CreateLevelManager(Z, A); }
+  }
+  if(Zmax > fMaxZUploaded.load(std::memory_order_relaxed)) {
+    fMaxZUploaded.store(Zmax, std::memory_order_release);
   }
 #ifdef G4MULTITHREADED
   G4MUTEXUNLOCK(&G4NuclearLevelData::nuclearLevelDataMutex);
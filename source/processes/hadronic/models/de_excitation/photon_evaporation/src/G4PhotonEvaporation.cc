@@ -103,6 +103,11 @@ void G4PhotonEvaporation::Initialise()
 
   fTransition->SetPolarizationFlag(param->CorrelatedGamma());
   fTransition->SetVerbose(fVerbose);
+
+  // optional upload of level data, done only once for all threads
+  if(0 < param->GetMaxZForLevelUpload()) {
+    fNuclearLevelData->UploadNuclearLevelData(param->GetMaxZForLevelUpload());
+  }
 }
 
 G4Fragment* 
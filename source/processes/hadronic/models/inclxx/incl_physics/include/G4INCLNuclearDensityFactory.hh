@@ -56,6 +56,14 @@ namespace G4INCL {
 
     NuclearDensity const *createDensity(const G4int A, const G4int Z);
 
+    /** \brief Build the r-p correlation and CDF tables of a nucleus
+     *
+     * The tables are shared between threads; calling this function on the
+     * master thread before the run avoids building them on first use in
+     * the workers.
+     */
+    void precomputeTables(const G4int A, const G4int Z);
+
     void addRPCorrelationToCache(const G4int A, const G4int Z, const ParticleType t, InterpolationTable * const table);
 
     void addDensityToCache(const G4int A, const G4int Z, NuclearDensity * const density);
@@ -43,16 +43,102 @@
 #include "G4INCLNDFHardSphere.hh"
 #include "G4INCLInvFInterpolationTable.hh"
 
+#ifdef INCLXX_IN_GEANT4_MODE
+#include "G4AutoLock.hh"
+#endif // INCLXX_IN_GEANT4_MODE
+#include <algorithm>
+
 namespace G4INCL {
 
   namespace NuclearDensityFactory {
 
     namespace {
 
+      // Per-thread caches, looked up without locking. The interpolation
+      // tables they point to are owned by the shared caches below, except
+      // for the tables handed over by addRPCorrelationToCache.
       G4ThreadLocal std::map<G4int,NuclearDensity const *> *nuclearDensityCache = NULL;
       G4ThreadLocal std::map<G4int,InterpolationTable*> *rpCorrelationTableCache = NULL;
       G4ThreadLocal std::map<G4int,InterpolationTable*> *rCDFTableCache = NULL;
       G4ThreadLocal std::map<G4int,InterpolationTable*> *pCDFTableCache = NULL;
+      G4ThreadLocal std::vector<InterpolationTable*> *ownedTables = NULL;
+
+      // Immutable tables shared between threads. The key contains the
+      // nuclide ID and the parameters of the density function, so that
+      // threads with a different configuration never share a table.
+      typedef std::vector<G4double> SharedTableKey;
+      typedef std::map<SharedTableKey,InterpolationTable*> SharedTableMap;
+
+      struct SharedTables {
+        SharedTableMap rpCorrelation;
+        SharedTableMap rCDF;
+        SharedTableMap pCDF;
+        ~SharedTables() {
+          deleteAll(rpCorrelation);
+          deleteAll(rCDF);
+          deleteAll(pCDF);
+        }
+        void deleteAll(SharedTableMap &m) {
+          for(SharedTableMap::const_iterator i = m.begin(); i!=m.end(); ++i)
+            delete i->second;
+          m.clear();
+        }
+      };
+
+      SharedTables theSharedTables;
+
+#ifdef INCLXX_IN_GEANT4_MODE
+      G4Mutex sharedTablesMutex = G4MUTEX_INITIALIZER;
+#endif // INCLXX_IN_GEANT4_MODE
+
+      /// \brief Look up a shared table, NULL if not yet built
+      InterpolationTable *findSharedTable(SharedTableMap &m, SharedTableKey const &key) {
+#ifdef INCLXX_IN_GEANT4_MODE
+        G4AutoLock l(&sharedTablesMutex);
+#endif // INCLXX_IN_GEANT4_MODE
+        const SharedTableMap::const_iterator i = m.find(key);
+        return (i==m.end()) ? NULL : i->second;
+      }
+
+      /** \brief Publish a table built by this thread
+       *
+       * If another thread published a table with the same key in the
+       * meantime, the new table is deleted and the existing one is returned.
+       */
+      InterpolationTable *insertSharedTable(SharedTableMap &m, SharedTableKey const &key, InterpolationTable *theTable) {
+#ifdef INCLXX_IN_GEANT4_MODE
+        G4AutoLock l(&sharedTablesMutex);
+#endif // INCLXX_IN_GEANT4_MODE
+        const SharedTableMap::const_iterator i = m.find(key);
+        if(i!=m.end()) {
+          delete theTable;
+          return i->second;
+        }
+        m[key] = theTable;
+        return theTable;
+      }
+
+      /// \brief Get a shared table, building it from the function if needed
+      InterpolationTable *getSharedTable(SharedTableMap &m, SharedTableKey const &key, IFunction1D *theFunction, IFunction1D::ManipulatorFunc fWrap=0) {
+        InterpolationTable *theTable = findSharedTable(m, key);
+        if(!theTable) {
+          // the integration is done outside of the lock
+          theTable = insertSharedTable(m, key, theFunction->inverseCDFTable(fWrap));
+        }
+        delete theFunction;
+        return theTable;
+      }
+
+      /// \brief Delete a table if it is owned by this thread
+      void deleteOwnedTable(InterpolationTable *theTable) {
+        if(!ownedTables)
+          return;
+        std::vector<InterpolationTable*>::iterator i = std::find(ownedTables->begin(), ownedTables->end(), theTable);
+        if(i!=ownedTables->end()) {
+          ownedTables->erase(i);
+          delete theTable;
+        }
+      }
 
     }
 
@@ -88,22 +174,26 @@ namespace G4INCL {
         INCL_DEBUG("Creating r-p correlation function for " << ((t==Proton) ? "protons" : "neutrons") << " in A=" << A << ", Z=" << Z << std::endl);
 
         IFunction1D *rpCorrelationFunction;
+        SharedTableKey key(1, nuclideID);
         if(A > 19) {
           const G4double radius = ParticleTable::getRadiusParameter(t, A, Z);
           const G4double diffuseness = ParticleTable::getSurfaceDiffuseness(t, A, Z);
           const G4double maximumRadius = ParticleTable::getMaximumNuclearRadius(t, A, Z);
           rpCorrelationFunction = new NuclearDensityFunctions::WoodsSaxonRP(radius, maximumRadius, diffuseness);
+          key.push_back(radius); key.push_back(diffuseness); key.push_back(maximumRadius);
           INCL_DEBUG(" ... Woods-Saxon; R0=" << radius << ", a=" << diffuseness << ", Rmax=" << maximumRadius << std::endl);
         } else if(A <= 19 && A > 6) {
           const G4double radius = ParticleTable::getRadiusParameter(t, A, Z);
           const G4double diffuseness = ParticleTable::getSurfaceDiffuseness(t, A, Z);
           const G4double maximumRadius = ParticleTable::getMaximumNuclearRadius(t, A, Z);
           rpCorrelationFunction = new NuclearDensityFunctions::ModifiedHarmonicOscillatorRP(radius, maximumRadius, diffuseness);
+          key.push_back(radius); key.push_back(diffuseness); key.push_back(maximumRadius);
           INCL_DEBUG(" ... MHO; param1=" << radius << ", param2=" << diffuseness << ", Rmax=" << maximumRadius << std::endl);
         } else if(A <= 6 && A > 1) { // Gaussian distribution for light nuclei
           const G4double radius = ParticleTable::getRadiusParameter(t, A, Z);
           const G4double maximumRadius = ParticleTable::getMaximumNuclearRadius(t, A, Z);
           rpCorrelationFunction = new NuclearDensityFunctions::GaussianRP(maximumRadius, Math::oneOverSqrtThree * radius);
+          key.push_back(radius); key.push_back(maximumRadius);
           INCL_DEBUG(" ... Gaussian; sigma=" << radius << ", Rmax=" << maximumRadius << std::endl);
         } else {
           INCL_ERROR("No r-p correlation function for " << ((t==Proton) ? "protons" : "neutrons") << " in A = "
@@ -111,8 +201,7 @@ namespace G4INCL {
           return NULL;
         }
 
-        InterpolationTable *theTable = rpCorrelationFunction->inverseCDFTable(Math::pow13);
-        delete rpCorrelationFunction;
+        InterpolationTable *theTable = getSharedTable(theSharedTables.rpCorrelation, key, rpCorrelationFunction, Math::pow13);
         INCL_DEBUG(" ... here comes the table:\n" << theTable->print() << '\n');
 
         (*rpCorrelationTableCache)[nuclideID] = theTable;
@@ -133,20 +222,24 @@ namespace G4INCL {
       if(mapEntry == rCDFTableCache->end()) {
 
         IFunction1D *rDensityFunction;
+        SharedTableKey key(1, nuclideID);
         if(A > 19) {
           G4double radius = ParticleTable::getRadiusParameter(t, A, Z);
           G4double diffuseness = ParticleTable::getSurfaceDiffuseness(t, A, Z);
           G4double maximumRadius = ParticleTable::getMaximumNuclearRadius(t, A, Z);
           rDensityFunction = new NuclearDensityFunctions::WoodsSaxon(radius, maximumRadius, diffuseness);
+          key.push_back(radius); key.push_back(diffuseness); key.push_back(maximumRadius);
         } else if(A <= 19 && A > 6) {
           G4double radius = ParticleTable::getRadiusParameter(t, A, Z);
           G4double diffuseness = ParticleTable::getSurfaceDiffuseness(t, A, Z);
           G4double maximumRadius = ParticleTable::getMaximumNuclearRadius(t, A, Z);
           rDensityFunction = new NuclearDensityFunctions::ModifiedHarmonicOscillator(radius, maximumRadius, diffuseness);
+          key.push_back(radius); key.push_back(diffuseness); key.push_back(maximumRadius);
         } else if(A <= 6 && A > 2) { // Gaussian distribution for light nuclei
           G4double radius = ParticleTable::getRadiusParameter(t, A, Z);
           G4double maximumRadius = ParticleTable::getMaximumNuclearRadius(t, A, Z);
           rDensityFunction = new NuclearDensityFunctions::Gaussian(maximumRadius, Math::oneOverSqrtThree * radius);
+          key.push_back(radius); key.push_back(maximumRadius);
         } else if(A == 2 && Z == 1) { // density from the Paris potential for deuterons
           rDensityFunction = new NuclearDensityFunctions::ParisR();
         } else {
@@ -155,8 +248,7 @@ namespace G4INCL {
           return NULL;
         }
 
-        InterpolationTable *theTable = rDensityFunction->inverseCDFTable();
-        delete rDensityFunction;
+        InterpolationTable *theTable = getSharedTable(theSharedTables.rCDF, key, rDensityFunction);
         INCL_DEBUG("Creating inverse position CDF for A=" << A << ", Z=" << Z << ":" <<
               '\n' << theTable->print() << '\n');
 
@@ -177,12 +269,15 @@ namespace G4INCL {
       const std::map<G4int,InterpolationTable*>::const_iterator mapEntry = pCDFTableCache->find(nuclideID);
       if(mapEntry == pCDFTableCache->end()) {
         IFunction1D *pDensityFunction;
+        SharedTableKey key(1, nuclideID);
         if(A > 19) {
           const G4double theFermiMomentum = ParticleTable::getFermiMomentum(A, Z);
           pDensityFunction = new NuclearDensityFunctions::HardSphere(theFermiMomentum);
+          key.push_back(theFermiMomentum);
         } else if(A <= 19 && A > 2) { // Gaussian distribution for light nuclei
           const G4double momentumRMS = Math::oneOverSqrtThree * ParticleTable::getMomentumRMS(A, Z);
           pDensityFunction = new NuclearDensityFunctions::Gaussian(5.*momentumRMS, momentumRMS);
+          key.push_back(momentumRMS);
         } else if(A == 2 && Z == 1) { // density from the Paris potential for deuterons
           pDensityFunction = new NuclearDensityFunctions::ParisP();
         } else {
@@ -191,8 +286,7 @@ namespace G4INCL {
           return NULL;
         }
 
-        InterpolationTable *theTable = pDensityFunction->inverseCDFTable();
-        delete pDensityFunction;
+        InterpolationTable *theTable = getSharedTable(theSharedTables.pCDF, key, pDensityFunction);
         INCL_DEBUG("Creating inverse momentum CDF for A=" << A << ", Z=" << Z << ":" <<
               '\n' << theTable->print() << '\n');
 
@@ -203,18 +297,32 @@ namespace G4INCL {
       }
     }
 
+    void precomputeTables(const G4int A, const G4int Z) {
+      if(A <= 2)
+        return;
+      createRPCorrelationTable(Proton, A, Z);
+      createRPCorrelationTable(Neutron, A, Z);
+      createRCDFTable(Proton, A, Z);
+      createRCDFTable(Neutron, A, Z);
+      createPCDFTable(Proton, A, Z);
+      createPCDFTable(Neutron, A, Z);
+    }
+
     void addRPCorrelationToCache(const G4int A, const G4int Z, const ParticleType t, InterpolationTable * const table) {
 // assert(t==Proton || t==Neutron);
 
       if(!rpCorrelationTableCache)
         rpCorrelationTableCache = new std::map<G4int,InterpolationTable*>;
+      if(!ownedTables)
+        ownedTables = new std::vector<InterpolationTable*>;
 
       const G4int nuclideID = ((t==Proton) ? 1000 : -1000)*Z + A; // MCNP-style nuclide IDs
       const std::map<G4int,InterpolationTable*>::const_iterator mapEntry = rpCorrelationTableCache->find(nuclideID);
       if(mapEntry != rpCorrelationTableCache->end())
-        delete mapEntry->second;
+        deleteOwnedTable(mapEntry->second);
 
       (*rpCorrelationTableCache)[nuclideID] = table;
+      ownedTables->push_back(table);
     }
 
     void addDensityToCache(const G4int A, const G4int Z, NuclearDensity * const density) {
@@ -239,26 +347,27 @@ namespace G4INCL {
         nuclearDensityCache = NULL;
       }
 
+      // the shared tables are kept for the other threads and for the next
+      // instance of the model; only the tables owned by this thread are
+      // deleted
+      if(ownedTables) {
+        for(std::vector<InterpolationTable*>::const_iterator i = ownedTables->begin(); i!=ownedTables->end(); ++i)
+          delete *i;
+        delete ownedTables;
+        ownedTables = NULL;
+      }
+
       if(rpCorrelationTableCache) {
-        for(std::map<G4int,InterpolationTable*>::const_iterator i = rpCorrelationTableCache->begin(); i!=rpCorrelationTableCache->end(); ++i)
-          delete i->second;
-        rpCorrelationTableCache->clear();
         delete rpCorrelationTableCache;
         rpCorrelationTableCache = NULL;
       }
 
       if(rCDFTableCache) {
-        for(std::map<G4int,InterpolationTable*>::const_iterator i = rCDFTableCache->begin(); i!=rCDFTableCache->end(); ++i)
-          delete i->second;
-        rCDFTableCache->clear();
         delete rCDFTableCache;
         rCDFTableCache = NULL;
       }
 
       if(pCDFTableCache) {
-        for(std::map<G4int,InterpolationTable*>::const_iterator i = pCDFTableCache->begin(); i!=pCDFTableCache->end(); ++i)
-          delete i->second;
-        pCDFTableCache->clear();
         delete pCDFTableCache;
         pCDFTableCache = NULL;
       }
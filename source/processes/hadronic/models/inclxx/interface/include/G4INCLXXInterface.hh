@@ -132,6 +132,9 @@ public:
 
   virtual void ModelDescription(std::ostream& outFile) const;
 
+  /// \brief Precompute the nuclear density tables on the master, if requested
+  virtual void BuildPhysicsTable(const G4ParticleDefinition &);
+
   G4String const &GetDeExcitationModelName() const;
 
 private:
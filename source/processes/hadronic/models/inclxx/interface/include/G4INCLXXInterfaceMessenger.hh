@@ -50,6 +50,7 @@
 #include "G4UIdirectory.hh"
 #include "G4UIcommand.hh"
 #include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithABool.hh"
 #include "G4UIcmdWithAString.hh"
 #include "G4UIcmdWithADoubleAndUnit.hh"
 #include "G4String.hh"
@@ -76,6 +77,7 @@ class G4INCLXXInterfaceMessenger : public G4UImessenger
     G4UIcmdWithADoubleAndUnit *cascadeMinEnergyPerNucleonCmd;
     G4UIcmdWithAString *inclPhysicsCmd;
     G4UIcommand *useAblaCmd;
+    G4UIcmdWithABool *precomputeTablesCmd;
 };
 
 #endif
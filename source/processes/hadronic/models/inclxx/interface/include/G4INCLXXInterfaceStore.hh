@@ -91,6 +91,9 @@ class G4INCLXXInterfaceStore {
     /// \brief Setter for conservationTolerance
     void SetConservationTolerance(const G4double aTolerance);
 
+    /// \brief Setter for precomputeTables
+    void SetPrecomputeTables(const G4bool b);
+
 
 
 
@@ -123,6 +126,13 @@ class G4INCLXXInterfaceStore {
     /// \brief Getter for conservationTolerance
     G4double GetConservationTolerance() const;
 
+    /** \brief Getter for precomputeTables
+     *
+     * If true, the nuclear density tables of all the isotopes in the
+     * element table are built on the master thread at initialisation.
+     */
+    G4bool GetPrecomputeTables() const;
+
 
 
 
@@ -177,6 +187,7 @@ class G4INCLXXInterfaceStore {
     const G4int theMaxProjMassINCL;
     G4double cascadeMinEnergyPerNucleon;
     G4double conservationTolerance;
+    G4bool precomputeTables;
 
     G4INCLXXInterfaceMessenger *theINCLXXInterfaceMessenger;
 
@@ -55,6 +55,9 @@
 #include "G4VEvaporationChannel.hh"
 #include "G4CompetitiveFission.hh"
 #include "G4FissionLevelDensityParameterINCLXX.hh"
+#include "G4INCLNuclearDensityFactory.hh"
+#include "G4ElementTable.hh"
+#include "G4Threading.hh"
 
 G4INCLXXInterface::G4INCLXXInterface(G4VPreCompoundModel * const aPreCompound) :
   G4VIntraNuclearTransportModel(G4INCLXXInterfaceStore::GetInstance()->getINCLXXVersionName()),
@@ -588,6 +591,24 @@ G4double G4INCLXXInterface::remnant4MomentumScaling(G4double mass,
   }
 }
 
+void G4INCLXXInterface::BuildPhysicsTable(const G4ParticleDefinition &) {
+  // The density tables are shared between threads, so it is enough to build
+  // them once on the master. The model engine is needed to initialise the
+  // INCL++ particle table with the current configuration.
+  if(G4Threading::IsWorkerThread() || !theInterfaceStore->GetPrecomputeTables())
+    return;
+  theInterfaceStore->GetINCLModel();
+
+  const G4ElementTable *theElementTable = G4Element::GetElementTable();
+  for(G4ElementTable::const_iterator iEl=theElementTable->begin(), eEl=theElementTable->end(); iEl!=eEl; ++iEl) {
+    const G4Element *theElement = *iEl;
+    for(size_t i=0; i<theElement->GetNumberOfIsotopes(); ++i) {
+      const G4Isotope *theIsotope = theElement->GetIsotope(i);
+      G4INCL::NuclearDensityFactory::precomputeTables(theIsotope->GetN(), theIsotope->GetZ());
+    }
+  }
+}
+
 void G4INCLXXInterface::ModelDescription(std::ostream& outFile) const {
    outFile
      << "The Liège Intranuclear Cascade (INCL++) is a model for reactions induced\n"
@@ -100,6 +100,16 @@ G4INCLXXInterfaceMessenger::G4INCLXXInterfaceMessenger(G4INCLXXInterfaceStore *a
   useAblaCmd = new G4UIcommand((theUIDirectory + "useAbla").data(),this);
   useAblaCmd->SetGuidance("Use ABLA V3 as de-excitation model after INCL++.");
   useAblaCmd->AvailableForStates(G4State_Idle);
+
+  // This command requests the nuclear density tables to be built at
+  // initialisation for all the isotopes in the element table
+  precomputeTablesCmd = new G4UIcmdWithABool((theUIDirectory + "precomputeTables").data(),this);
+  precomputeTablesCmd->SetGuidance("Build the INCL++ nuclear density tables at initialisation.");
+  precomputeTablesCmd->SetGuidance(" The tables are built on the master thread for all the isotopes in the element table and shared with the worker threads");
+  precomputeTablesCmd->SetGuidance(" Default: false (tables are built on first use)");
+  precomputeTablesCmd->SetParameterName("PrecomputeTables",true);
+  precomputeTablesCmd->SetDefaultValue(true);
+  precomputeTablesCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
 }
 
 G4INCLXXInterfaceMessenger::~G4INCLXXInterfaceMessenger() {
@@ -109,6 +119,7 @@ G4INCLXXInterfaceMessenger::~G4INCLXXInterfaceMessenger() {
   delete cascadeMinEnergyPerNucleonCmd;
   delete inclPhysicsCmd;
   delete useAblaCmd;
+  delete precomputeTablesCmd;
 }
 
 void G4INCLXXInterfaceMessenger::SetNewValue(G4UIcommand *command, G4String newValues) {
@@ -129,5 +140,7 @@ void G4INCLXXInterfaceMessenger::SetNewValue(G4UIcommand *command, G4String newV
     theINCLXXInterfaceStore->SetINCLPhysics(newValues);
   } else if(command==useAblaCmd) {
     theINCLXXInterfaceStore->UseAblaDeExcitation();
+  } else if(command==precomputeTablesCmd) {
+    theINCLXXInterfaceStore->SetPrecomputeTables(precomputeTablesCmd->GetNewBoolValue(newValues));
   }
 }
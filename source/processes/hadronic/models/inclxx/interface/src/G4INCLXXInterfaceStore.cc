@@ -60,6 +60,7 @@ G4INCLXXInterfaceStore::G4INCLXXInterfaceStore() :
   theMaxProjMassINCL(18),
   cascadeMinEnergyPerNucleon(1.*MeV),
   conservationTolerance(5*MeV),
+  precomputeTables(false),
   theINCLModel(NULL),
   theTally(NULL),
   nWarnings(0),
@@ -163,6 +164,8 @@ G4INCL::Config &G4INCLXXInterfaceStore::GetINCLConfig() {
 
 G4double G4INCLXXInterfaceStore::GetConservationTolerance() const { return conservationTolerance; }
 
+G4bool G4INCLXXInterfaceStore::GetPrecomputeTables() const { return precomputeTables; }
+
 
 
 
@@ -214,6 +217,11 @@ void G4INCLXXInterfaceStore::SetConservationTolerance(const G4double aTolerance)
   conservationTolerance = aTolerance;
 }
 
+void G4INCLXXInterfaceStore::SetPrecomputeTables(const G4bool b) {
+  // No need to delete the model for this parameter
+  precomputeTables = b;
+}
+
 G4INCLXXVInterfaceTally *G4INCLXXInterfaceStore::GetTally() const { return theTally; }
 
 void G4INCLXXInterfaceStore::SetTally(G4INCLXXVInterfaceTally * const aTally) { theTally = aTally; }
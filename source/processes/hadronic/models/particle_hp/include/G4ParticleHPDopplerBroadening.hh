@@ -0,0 +1,70 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// Class Description
+// Deterministic on the fly Doppler broadening of a tabulated cross 
+// section for a free gas target at the material temperature. The 
+// convolution with the target motion is written in the variable 
+// U = sqrt(E_rel) as
+//   sigma(E) = sqrt(a/pi)/E * Int dU g(U) exp(-a (U - sqrt(E))^2),
+//   g(U) = sign(U) U^2 sigma0(U^2),  a = (M/m)/kT
+// and is integrated by the trapezoidal rule over a window of 4 Doppler
+// widths. The integration nodes are a fixed uniform set plus the data
+// nodes inside the window, limited to a fixed number, so the cost per 
+// lookup is bounded and no per-temperature copies of data are needed. 
+// This is an alternative to the Monte Carlo sampling of the thermal 
+// nucleus used by default in the ParticleHP cross section data sets.
+// Class Description - End
+//
+// 19.10.2026 First implementation
+//
+#ifndef G4ParticleHPDopplerBroadening_h
+#define G4ParticleHPDopplerBroadening_h 1
+
+#include "globals.hh"
+
+class G4PhysicsVector;
+class G4ParticleHPHashedGrid;
+
+class G4ParticleHPDopplerBroadening
+{
+public:
+
+  // vec     - cross section at zero temperature
+  // grid    - optional hashed copy of vec used for interpolation
+  // eKin    - kinetic energy of the projectile
+  // massRatio - target mass over projectile mass
+  // kT      - temperature in energy units
+  static G4double GetCrossSection( const G4PhysicsVector* vec,
+                                   const G4ParticleHPHashedGrid* grid,
+                                   G4double eKin, G4double massRatio,
+                                   G4double kT );
+
+private:
+
+  G4ParticleHPDopplerBroadening() = delete;
+};
+
+#endif
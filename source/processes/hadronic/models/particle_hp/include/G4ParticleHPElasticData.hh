@@ -30,6 +30,8 @@
 // 091118 Add Ignore and Enable On Flight Doppler Broadening methods by T. Koi
 //
 // P. Arce, June-2014 Conversion neutron_hp to particle_hp
+// 19.10.2026 optional lookup of element cross sections on hashed energy grids
+// 19.10.2026 optional deterministic Doppler broadening
 //
 #ifndef G4ParticleHPElasticData_h
 #define G4ParticleHPElasticData_h 1
@@ -47,6 +49,7 @@
 #include "G4Element.hh"
 #include "G4ParticleDefinition.hh"
 #include "G4PhysicsTable.hh"
+#include "G4ParticleHPHashedGrid.hh"
 
 class G4ParticleHPElasticData : public G4VCrossSectionDataSet
 {
@@ -88,9 +91,17 @@ class G4ParticleHPElasticData : public G4VCrossSectionDataSet
       virtual void CrossSectionDescription(std::ostream&) const;
    
    private:
+
+      inline G4double LookUpCrossSection( G4int index , G4double e ) const
+      {
+         if ( theHashedGrids != NULL ) return (*theHashedGrids)[index]->Value( e );
+         return (*theCrossSections)(index)->Value( e );
+      }
    
       G4PhysicsTable * theCrossSections;
+      std::vector<G4ParticleHPHashedGrid*>* theHashedGrids;
       G4bool onFlightDB;
+      G4bool dopplerQuadrature;
       G4bool instanceOfWorker;
 
       G4double ke_cache;
@@ -27,6 +27,8 @@
 // 080417 Add IsZAApplicable method (return false) by T. Koi
 //
 // P. Arce, June-2014 Conversion neutron_hp to particle_hp
+// 19.10.2026 optional lookup of element cross sections on hashed energy grids
+// 19.10.2026 optional deterministic Doppler broadening
 //
 #ifndef G4ParticleHPFissionData_h
 #define G4ParticleHPFissionData_h 1
@@ -44,6 +46,7 @@
 #include "G4Element.hh"
 #include "G4ParticleDefinition.hh"
 #include "G4PhysicsTable.hh"
+#include "G4ParticleHPHashedGrid.hh"
 
 class G4ParticleHPFissionData : public G4VCrossSectionDataSet
 {
@@ -82,10 +85,18 @@ class G4ParticleHPFissionData : public G4VCrossSectionDataSet
       virtual void CrossSectionDescription(std::ostream&) const;
 
    private:
+
+      inline G4double LookUpCrossSection( G4int index , G4double e ) const
+      {
+         if ( theHashedGrids != NULL ) return (*theHashedGrids)[index]->Value( e );
+         return (*theCrossSections)(index)->Value( e );
+      }
    
       G4PhysicsTable * theCrossSections;
+      std::vector<G4ParticleHPHashedGrid*>* theHashedGrids;
 
       G4bool onFlightDB;
+      G4bool dopplerQuadrature;
       G4bool instanceOfWorker;
 
       G4double ke_cache;
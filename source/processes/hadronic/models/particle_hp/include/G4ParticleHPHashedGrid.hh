@@ -0,0 +1,94 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// Class Description
+// Copy of the element cross section of ParticleHP data sets with a 
+// hashed index in log(E): the energy range is split in buckets of 
+// equal logarithmic width, each bucket keeps the index of the first 
+// node below its lower edge. A lookup is one bucket jump followed by a
+// short forward scan and the same linear interpolation as used by 
+// G4PhysicsVector. The element vector is already the union grid of all
+// isotopes of the element.
+// Class Description - End
+//
+// 19.10.2026 First implementation
+//
+#ifndef G4ParticleHPHashedGrid_h
+#define G4ParticleHPHashedGrid_h 1
+
+#include "globals.hh"
+#include "G4Log.hh"
+#include <vector>
+#include <algorithm>
+
+class G4PhysicsVector;
+
+class G4ParticleHPHashedGrid
+{
+public:
+
+  explicit G4ParticleHPHashedGrid(const G4PhysicsVector* vec);
+
+  ~G4ParticleHPHashedGrid();
+
+  inline G4double Value(G4double e) const;
+
+  inline size_t GetNumberOfNodes() const { return theEnergy.size(); }
+  inline size_t GetNumberOfBuckets() const { return theBucket.size(); }
+
+private:
+
+  G4ParticleHPHashedGrid(const G4ParticleHPHashedGrid&) = delete;
+  G4ParticleHPHashedGrid& operator=(const G4ParticleHPHashedGrid&) = delete;
+
+  std::vector<G4double> theEnergy;
+  std::vector<G4double> theValue;
+  std::vector<G4int> theBucket;
+
+  G4double logEmin;
+  G4double invLogStep;
+};
+
+inline G4double G4ParticleHPHashedGrid::Value(G4double e) const
+{
+  // same convention as G4PhysicsVector::Value
+  const size_t n = theEnergy.size();
+  if(0 == n) { return 0.0; }
+  if(e <= theEnergy[0]) { return theValue[0]; }
+  if(e >= theEnergy[n-1]) { return theValue[n-1]; }
+
+  G4int b = G4int((G4Log(e) - logEmin)*invLogStep);
+  b = std::min(std::max(b, 0), G4int(theBucket.size()) - 1);
+
+  // find i with theEnergy[i] < e <= theEnergy[i+1]
+  size_t i = theBucket[b];
+  while(i > 0 && theEnergy[i] >= e) { --i; }
+  while(theEnergy[i+1] < e) { ++i; }
+
+  return theValue[i] + (theValue[i+1] - theValue[i])*(e - theEnergy[i])
+    /(theEnergy[i+1] - theEnergy[i]);
+}
+
+#endif
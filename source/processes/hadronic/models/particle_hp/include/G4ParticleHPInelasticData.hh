@@ -29,6 +29,8 @@
 // 091118 Add Ignore and Enable On Flight Doppler Broadening methods by T. Koi
 //
 // P. Arce, June-2014 Conversion neutron_hp to particle_hp
+// 19.10.2026 optional lookup of element cross sections on hashed energy grids
+// 19.10.2026 optional deterministic Doppler broadening
 //
 #ifndef G4ParticleHPInelasticData_h
 #define G4ParticleHPInelasticData_h 1
@@ -46,6 +48,7 @@
 #include "G4Element.hh"
 #include "G4ParticleDefinition.hh"
 #include "G4PhysicsTable.hh"
+#include "G4ParticleHPHashedGrid.hh"
 #include "G4Neutron.hh"
 
 class G4ParticleHPData;
@@ -93,10 +96,18 @@ class G4ParticleHPInelasticData : public G4VCrossSectionDataSet
       virtual void CrossSectionDescription(std::ostream&) const;
  
    private:
+
+      inline G4double LookUpCrossSection( G4int index , G4double e ) const
+      {
+         if ( theHashedGrids != NULL ) return (*theHashedGrids)[index]->Value( e );
+         return (*theCrossSections)(index)->Value( e );
+      }
    
       G4PhysicsTable * theCrossSections;
+      std::vector<G4ParticleHPHashedGrid*>* theHashedGrids;
 
       G4bool onFlightDB;
+      G4bool dopplerQuadrature;
 
   G4ParticleDefinition* theProjectile;
 
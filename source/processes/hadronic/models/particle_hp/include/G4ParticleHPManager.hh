@@ -34,6 +34,8 @@
 // Class Description - End
 
 // 121031 First implementation done by T. Koi (SLAC/PPA)
+// 19.10.2026 optional hashed energy grids of element cross sections
+// 19.10.2026 optional deterministic Doppler broadening of cross sections
 //
 #include <map>
 #include <vector>
@@ -46,6 +48,7 @@ class G4ParticleHPChannel;
 class G4ParticleHPChannelList;
 class G4ParticleHPMessenger;
 class G4ParticleHPVector;
+class G4ParticleHPHashedGrid;
 class G4PhysicsTable;
 struct E_isoAng;
 struct E_P_E_isoAng;
@@ -84,11 +87,15 @@ class G4ParticleHPManager
       G4bool GetNeglectDoppler() { return NEGLECT_DOPPLER; };
       G4bool GetDoNotAdjustFinalState() { return DO_NOT_ADJUST_FINAL_STATE; };
       G4bool GetProduceFissionFragments() { return PRODUCE_FISSION_FRAGMENTS; };
+      G4bool GetUseHashedEnergyGrid() { return USE_HASHED_ENERGY_GRID; };
+      G4bool GetUseDopplerQuadrature() { return USE_DOPPLER_QUADRATURE; };
 
       void SetSkipMissingIsotopes( G4bool val ) { SKIP_MISSING_ISOTOPES = val; };
       void SetNeglectDoppler( G4bool val ) { NEGLECT_DOPPLER = val; };
       void SetDoNotAdjustFinalState( G4bool val ) { DO_NOT_ADJUST_FINAL_STATE = val; };
       void SetProduceFissionFragments( G4bool val ) { PRODUCE_FISSION_FRAGMENTS = val; };
+      void SetUseHashedEnergyGrid( G4bool val ) { USE_HASHED_ENERGY_GRID = val; };
+      void SetUseDopplerQuadrature( G4bool val ) { USE_DOPPLER_QUADRATURE = val; };
 
       void RegisterElasticCrossSections( G4PhysicsTable* val ){ theElasticCrossSections = val; };
       G4PhysicsTable* GetElasticCrossSections(){ return theElasticCrossSections; };
@@ -99,6 +106,11 @@ class G4ParticleHPManager
       void RegisterFissionCrossSections( G4PhysicsTable* val ){ theFissionCrossSections = val; };
       G4PhysicsTable* GetFissionCrossSections(){ return theFissionCrossSections; };
 
+      // hashed energy grids of the element cross sections of a table;
+      // built by the master thread, shared with worker threads
+      std::vector<G4ParticleHPHashedGrid*>* BuildHashedGrids( const G4PhysicsTable* );
+      std::vector<G4ParticleHPHashedGrid*>* GetHashedGrids( const G4PhysicsTable* );
+
       std::vector<G4ParticleHPChannel*>* GetElasticFinalStates() { return theElasticFSs; };
       void RegisterElasticFinalStates( std::vector<G4ParticleHPChannel*>* val ) { theElasticFSs = val; };
       std::vector<G4ParticleHPChannelList*>* GetInelasticFinalStates( const G4ParticleDefinition* );
@@ -136,11 +148,14 @@ class G4ParticleHPManager
       G4bool NEGLECT_DOPPLER;
       G4bool DO_NOT_ADJUST_FINAL_STATE;
       G4bool PRODUCE_FISSION_FRAGMENTS;
+      G4bool USE_HASHED_ENERGY_GRID;
+      G4bool USE_DOPPLER_QUADRATURE;
 
       G4PhysicsTable* theElasticCrossSections;
       G4PhysicsTable* theCaptureCrossSections;
       std::map< const G4ParticleDefinition* , G4PhysicsTable* > theInelasticCrossSections;
       G4PhysicsTable* theFissionCrossSections;
+      std::map< const G4PhysicsTable* , std::vector<G4ParticleHPHashedGrid*>* > theHashedGrids;
 
       std::vector<G4ParticleHPChannel*>* theElasticFSs;
       std::map< const G4ParticleDefinition* , std::vector<G4ParticleHPChannelList*>* > theInelasticFSs;
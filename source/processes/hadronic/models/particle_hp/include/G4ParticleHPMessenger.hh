@@ -51,6 +51,8 @@ class G4ParticleHPMessenger: public G4UImessenger
       G4UIcmdWithAString* NeglectDopplerCmd;
       G4UIcmdWithAString* DoNotAdjustFSCmd;
       G4UIcmdWithAString* ProduceFissionFragementCmd;
+      G4UIcmdWithAString* HashedEnergyGridCmd;
+      G4UIcmdWithAString* DopplerQuadratureCmd;
       G4UIcmdWithAnInteger* VerboseCmd;
       //G4UIcmdWithAString* AllowHeavyElementCmd;
 /*
@@ -59,6 +61,8 @@ class G4ParticleHPMessenger: public G4UImessenger
  * #setenv G4NEUTRONHP_NEGLECT_DOPPLER 1
  * #setenv G4NEUTRONHP_DO_NOT_ADJUST_FINAL_STATE 1
  * #setenv G4NEUTRONHP_PRODUCE_FISSION_FRAGMENTS 1
+ * #setenv G4PHP_USE_HASHED_ENERGY_GRID 1
+ * #setenv G4PHP_DOPPLER_QUADRATURE 1
  *
 */
     
@@ -92,6 +92,7 @@ GEANT4_DEFINE_MODULE(NAME G4had_par_hp
     G4ParticleHPDataUsed.hh
     G4ParticleHPDeExGammas.hh
     G4ParticleHPDiscreteTwoBody.hh
+    G4ParticleHPDopplerBroadening.hh
     G4ParticleHPElastic.hh
     G4ParticleHPElasticData.hh
     G4ParticleHPElasticFS.hh
@@ -114,6 +115,7 @@ GEANT4_DEFINE_MODULE(NAME G4had_par_hp
     G4ParticleHPFissionSpectrum.hh
     G4ParticleHPGamma.hh
     G4ParticleHPHash.hh
+    G4ParticleHPHashedGrid.hh
     G4ParticleHPHe3InelasticFS.hh
     G4ParticleHPInelastic.hh
     G4ParticleHPInelasticBaseFS.hh
@@ -340,6 +342,7 @@ GEANT4_DEFINE_MODULE(NAME G4had_par_hp
     G4ParticleHPData.cc
     G4ParticleHPDeExGammas.cc
     G4ParticleHPDiscreteTwoBody.cc
+    G4ParticleHPDopplerBroadening.cc
     G4ParticleHPElastic.cc
     G4ParticleHPElasticData.cc
     G4ParticleHPElasticFS.cc
@@ -364,6 +367,7 @@ GEANT4_DEFINE_MODULE(NAME G4had_par_hp
     G4ParticleHPFissionData.cc
     G4ParticleHPFissionFS.cc
     G4ParticleHPGamma.cc
+    G4ParticleHPHashedGrid.cc
     G4ParticleHPHe3InelasticFS.cc
     G4ParticleHPInelastic.cc
     G4ParticleHPInelasticBaseFS.cc
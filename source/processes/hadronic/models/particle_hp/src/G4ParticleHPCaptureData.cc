@@ -38,6 +38,7 @@
 //
 #include "G4ParticleHPCaptureData.hh"
 #include "G4ParticleHPManager.hh"
+#include "G4ParticleHPDopplerBroadening.hh"
 #include "G4PhysicalConstants.hh"
 #include "G4SystemOfUnits.hh"
 #include "G4Neutron.hh"
@@ -54,7 +55,9 @@ G4ParticleHPCaptureData::G4ParticleHPCaptureData()
    SetMaxKinEnergy( 20*MeV );                                   
 
    theCrossSections = 0;
+   theHashedGrids = NULL;
    onFlightDB = true;
+   dopplerQuadrature = false;
 
    instanceOfWorker = false;
    if ( G4Threading::IsWorkerThread() ) {
@@ -130,8 +133,13 @@ void G4ParticleHPCaptureData::BuildPhysicsTable(const G4ParticleDefinition& aP)
       onFlightDB = false;
    }
 
+   dopplerQuadrature = G4ParticleHPManager::GetInstance()->GetUseDopplerQuadrature();
+
    if ( G4Threading::IsWorkerThread() ) {
       theCrossSections = G4ParticleHPManager::GetInstance()->GetCaptureCrossSections();
+      theHashedGrids = NULL;
+      if ( G4ParticleHPManager::GetInstance()->GetUseHashedEnergyGrid() )
+         theHashedGrids = G4ParticleHPManager::GetInstance()->GetHashedGrids( theCrossSections );
       return;
    }
   
@@ -160,6 +168,10 @@ void G4ParticleHPCaptureData::BuildPhysicsTable(const G4ParticleDefinition& aP)
   }
 
   G4ParticleHPManager::GetInstance()->RegisterCaptureCrossSections( theCrossSections );
+
+   theHashedGrids = NULL;
+   if ( G4ParticleHPManager::GetInstance()->GetUseHashedEnergyGrid() )
+      theHashedGrids = G4ParticleHPManager::GetInstance()->BuildHashedGrids( theCrossSections );
 }
 
 void G4ParticleHPCaptureData::DumpPhysicsTable(const G4ParticleDefinition& aP)
@@ -218,7 +230,6 @@ G4double G4ParticleHPCaptureData::
 GetCrossSection(const G4DynamicParticle* aP, const G4Element*anE, G4double aT)
 {
   G4double result = 0;
-  G4bool outOfRange;
   G4int index = anE->GetIndex();
 
   // prepare neutron
@@ -235,7 +246,7 @@ GetCrossSection(const G4DynamicParticle* aP, const G4Element*anE, G4double aT)
         // Will take care after performance check.  
         // factor = factor * targetV;
      }
-     return ( (*((*theCrossSections)(index))).GetValue(eKinetic, outOfRange) )* factor; 
+     return LookUpCrossSection( index , eKinetic ) * factor; 
   }
 
   G4ReactionProduct theNeutron( aP->GetDefinition() );
@@ -250,6 +261,13 @@ GetCrossSection(const G4DynamicParticle* aP, const G4Element*anE, G4double aT)
   G4double eleMass; 
   eleMass = G4NucleiProperties::GetNuclearMass( static_cast<G4int>(theA+eps) , static_cast<G4int>(theZ+eps) ) / G4Neutron::Neutron()->GetPDGMass();
   
+  if ( dopplerQuadrature ) 
+  {
+     return G4ParticleHPDopplerBroadening::GetCrossSection( (*theCrossSections)(index) , 
+                ( theHashedGrids != NULL ) ? (*theHashedGrids)[index] : NULL ,
+                eKinetic , eleMass , aT*k_Boltzmann );
+  }
+
   G4ReactionProduct boosted;
   G4double aXsection;
   
@@ -269,7 +287,7 @@ GetCrossSection(const G4DynamicParticle* aP, const G4Element*anE, G4double aT)
       G4ReactionProduct aThermalNuc = aNuc.GetThermalNucleus(eleMass, aT);
       boosted.Lorentz(theNeutron, aThermalNuc);
       G4double theEkin = boosted.GetKineticEnergy();
-      aXsection = (*((*theCrossSections)(index))).GetValue(theEkin, outOfRange);
+      aXsection = LookUpCrossSection( index , theEkin );
       // velocity correction, or luminosity factor...
       G4ThreeVector targetVelocity = 1./aThermalNuc.GetMass()*aThermalNuc.GetMomentum();
       aXsection *= (targetVelocity-neutronVelocity).mag()/neutronVMag;
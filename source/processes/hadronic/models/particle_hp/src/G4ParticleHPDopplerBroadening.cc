@@ -0,0 +1,121 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// 19.10.2026 First implementation
+//
+#include "G4ParticleHPDopplerBroadening.hh"
+#include "G4ParticleHPHashedGrid.hh"
+#include "G4PhysicsVector.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4Exp.hh"
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+  // uniform nodes in x = sqrt(a)*(U - u) over [-xmax, xmax]
+  const G4int nBaseNodes = 33;
+  const G4double xmax = 4.0;
+  // maximal number of data nodes used on each side of U = 0
+  const G4int nMaxDataNodes = 256;
+
+  // first index i with vec->Energy(i) >= e
+  size_t LowerIndex( const G4PhysicsVector* vec , G4double e )
+  {
+    size_t lo = 0;
+    size_t hi = vec->GetVectorLength();
+    while ( lo < hi ) {
+      size_t mid = (lo + hi)/2;
+      if ( vec->Energy(mid) < e ) { lo = mid + 1; }
+      else { hi = mid; }
+    }
+    return lo;
+  }
+}
+
+G4double G4ParticleHPDopplerBroadening::
+GetCrossSection( const G4PhysicsVector* vec, const G4ParticleHPHashedGrid* grid,
+                 G4double eKin, G4double massRatio, G4double kT )
+{
+   size_t n = vec->GetVectorLength();
+   if ( n == 0 ) return 0.0;
+   if ( grid == NULL && n == 1 ) return (*vec)[0];
+   if ( eKin <= 0.0 || kT <= 0.0 || massRatio <= 0.0 ) 
+      return ( grid != NULL ) ? grid->Value( eKin ) : vec->Value( eKin );
+
+   const G4double sa = std::sqrt( massRatio/kT );
+   const G4double u = std::sqrt( eKin );
+   const G4double umin = u - xmax/sa;
+   const G4double umax = u + xmax/sa;
+
+   // pairs of (U, sigma0(U^2))
+   std::pair<G4double,G4double> nodes[nBaseNodes + 2*nMaxDataNodes + 1];
+   G4int nn = 0;
+
+   const G4double dx = 2*xmax/(nBaseNodes - 1);
+   for ( G4int j = 0 ; j < nBaseNodes ; ++j ) {
+      G4double uu = u + (j*dx - xmax)/sa;
+      G4double e = uu*uu;
+      nodes[nn++] = std::make_pair( uu , ( grid != NULL ) ? grid->Value( e ) : vec->Value( e ) );
+   }
+   if ( umin < 0.0 ) {
+      nodes[nn++] = std::make_pair( 0.0 , ( grid != NULL ) ? grid->Value( 0.0 ) : vec->Value( 0.0 ) );
+   }
+
+   // data nodes for U > 0 and, if the window crosses zero, for U < 0 
+   for ( G4int side = 0 ; side < 2 ; ++side ) {
+      G4double elow, ehigh;
+      if ( side == 0 ) {
+         elow = ( umin > 0.0 ) ? umin*umin : 0.0;
+         ehigh = umax*umax;
+      } else {
+         if ( umin >= 0.0 ) break;
+         elow = 0.0;
+         ehigh = umin*umin;
+      }
+      size_t i0 = LowerIndex( vec , elow );
+      size_t i1 = LowerIndex( vec , ehigh );
+      if ( i1 <= i0 ) continue;
+      size_t stride = ( i1 - i0 + nMaxDataNodes - 1 )/nMaxDataNodes;
+      for ( size_t i = i0 ; i < i1 ; i += stride ) {
+         G4double uu = std::sqrt( vec->Energy(i) );
+         nodes[nn++] = std::make_pair( ( side == 0 ) ? uu : -uu , (*vec)[i] );
+      }
+   }
+   std::sort( nodes , nodes + nn );
+
+   // trapezoidal rule for g(U) exp(-a(U-u)^2)
+   G4double result = 0.0;
+   G4double f0 = 0.0;
+   for ( G4int k = 0 ; k < nn ; ++k ) {
+      G4double uu = nodes[k].first;
+      G4double x = sa*(uu - u);
+      G4double f = uu*std::abs(uu)*std::max( nodes[k].second , 0.0 )*G4Exp( -x*x );
+      if ( k > 0 ) result += 0.5*(f + f0)*(uu - nodes[k-1].first);
+      f0 = f;
+   }
+   result *= sa/(std::sqrt(CLHEP::pi)*eKin);
+   return std::max( result , 0.0 );
+}
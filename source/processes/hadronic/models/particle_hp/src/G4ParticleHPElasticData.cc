@@ -38,6 +38,7 @@
 //
 #include "G4ParticleHPElasticData.hh"
 #include "G4ParticleHPManager.hh"
+#include "G4ParticleHPDopplerBroadening.hh"
 #include "G4PhysicalConstants.hh"
 #include "G4SystemOfUnits.hh"
 #include "G4Neutron.hh"
@@ -53,7 +54,9 @@ G4ParticleHPElasticData::G4ParticleHPElasticData()
    SetMaxKinEnergy( 20*MeV );                                   
 
    theCrossSections = 0;
+   theHashedGrids = NULL;
    onFlightDB = true;
+   dopplerQuadrature = false;
    instanceOfWorker = false;
    if ( G4Threading::IsWorkerThread() ) {
       instanceOfWorker = true;
@@ -128,8 +131,13 @@ void G4ParticleHPElasticData::BuildPhysicsTable(const G4ParticleDefinition& aP)
       onFlightDB = false;
    }
 
+   dopplerQuadrature = G4ParticleHPManager::GetInstance()->GetUseDopplerQuadrature();
+
    if ( G4Threading::IsWorkerThread() ) {
       theCrossSections = G4ParticleHPManager::GetInstance()->GetElasticCrossSections();
+      theHashedGrids = NULL;
+      if ( G4ParticleHPManager::GetInstance()->GetUseHashedEnergyGrid() )
+         theHashedGrids = G4ParticleHPManager::GetInstance()->GetHashedGrids( theCrossSections );
       return;
    }
 
@@ -152,6 +160,10 @@ void G4ParticleHPElasticData::BuildPhysicsTable(const G4ParticleDefinition& aP)
   }
 
    G4ParticleHPManager::GetInstance()->RegisterElasticCrossSections(theCrossSections);
+
+   theHashedGrids = NULL;
+   if ( G4ParticleHPManager::GetInstance()->GetUseHashedEnergyGrid() )
+      theHashedGrids = G4ParticleHPManager::GetInstance()->BuildHashedGrids( theCrossSections );
 }
 
 void G4ParticleHPElasticData::DumpPhysicsTable(const G4ParticleDefinition& aP)
@@ -213,7 +225,6 @@ G4double G4ParticleHPElasticData::
 GetCrossSection(const G4DynamicParticle* aP, const G4Element*anE, G4double aT)
 {
   G4double result = 0;
-  G4bool outOfRange;
   G4int index = anE->GetIndex();
 
   // prepare neutron
@@ -230,7 +241,7 @@ GetCrossSection(const G4DynamicParticle* aP, const G4Element*anE, G4double aT)
         // Will take care after performance check.  
         // factor = factor * targetV;
      }
-     return ( (*((*theCrossSections)(index))).GetValue(eKinetic, outOfRange) )* factor; 
+     return LookUpCrossSection( index , eKinetic ) * factor; 
   }
 
   G4ReactionProduct theNeutron( aP->GetDefinition() );
@@ -248,6 +259,13 @@ GetCrossSection(const G4DynamicParticle* aP, const G4Element*anE, G4double aT)
   eleMass = ( G4NucleiProperties::GetNuclearMass( static_cast<G4int>(theA+eps) , static_cast<G4int>(theZ+eps) )
 	     ) / G4Neutron::Neutron()->GetPDGMass();
   
+  if ( dopplerQuadrature ) 
+  {
+     return G4ParticleHPDopplerBroadening::GetCrossSection( (*theCrossSections)(index) , 
+                ( theHashedGrids != NULL ) ? (*theHashedGrids)[index] : NULL ,
+                eKinetic , eleMass , aT*k_Boltzmann );
+  }
+
   G4ReactionProduct boosted;
   G4double aXsection;
   
@@ -267,7 +285,7 @@ GetCrossSection(const G4DynamicParticle* aP, const G4Element*anE, G4double aT)
       G4ReactionProduct aThermalNuc = aNuc.GetThermalNucleus(eleMass, aT);
       boosted.Lorentz(theNeutron, aThermalNuc);
       G4double theEkin = boosted.GetKineticEnergy();
-      aXsection = (*((*theCrossSections)(index))).GetValue(theEkin, outOfRange);
+      aXsection = LookUpCrossSection( index , theEkin );
       // velocity correction.
       G4ThreeVector targetVelocity = 1./aThermalNuc.GetMass()*aThermalNuc.GetMomentum();
       aXsection *= (targetVelocity-neutronVelocity).mag()/neutronVMag;
@@ -36,6 +36,7 @@
 //
 #include "G4ParticleHPFissionData.hh"
 #include "G4ParticleHPManager.hh"
+#include "G4ParticleHPDopplerBroadening.hh"
 #include "G4PhysicalConstants.hh"
 #include "G4SystemOfUnits.hh"
 #include "G4Neutron.hh"
@@ -51,7 +52,9 @@ G4ParticleHPFissionData::G4ParticleHPFissionData()
    SetMaxKinEnergy( 20*MeV );                                   
 
    theCrossSections = 0;
+   theHashedGrids = NULL;
    onFlightDB = true;
+   dopplerQuadrature = false;
    instanceOfWorker = false;
    if ( G4Threading::IsWorkerThread() ) {
       instanceOfWorker = true;
@@ -120,11 +123,16 @@ void G4ParticleHPFissionData::BuildPhysicsTable(const G4ParticleDefinition& aP)
       onFlightDB = false;
    } 
 
+   dopplerQuadrature = G4ParticleHPManager::GetInstance()->GetUseDopplerQuadrature();
+
   if(&aP!=G4Neutron::Neutron()) 
      throw G4HadronicException(__FILE__, __LINE__, "Attempt to use NeutronHP data for particles other than neutrons!!!");  
 
    if ( G4Threading::IsWorkerThread() ) {
       theCrossSections = G4ParticleHPManager::GetInstance()->GetFissionCrossSections();
+      theHashedGrids = NULL;
+      if ( G4ParticleHPManager::GetInstance()->GetUseHashedEnergyGrid() )
+         theHashedGrids = G4ParticleHPManager::GetInstance()->GetHashedGrids( theCrossSections );
       return;
    }
 
@@ -148,6 +156,10 @@ void G4ParticleHPFissionData::BuildPhysicsTable(const G4ParticleDefinition& aP)
   }
 
    G4ParticleHPManager::GetInstance()->RegisterFissionCrossSections( theCrossSections );
+
+   theHashedGrids = NULL;
+   if ( G4ParticleHPManager::GetInstance()->GetUseHashedEnergyGrid() )
+      theHashedGrids = G4ParticleHPManager::GetInstance()->BuildHashedGrids( theCrossSections );
 }
 
 void G4ParticleHPFissionData::DumpPhysicsTable(const G4ParticleDefinition& aP)
@@ -213,7 +225,6 @@ GetCrossSection(const G4DynamicParticle* aP, const G4Element*anE, G4double aT)
 {
   G4double result = 0;
   if(anE->GetZ()<88) return result;
-  G4bool outOfRange;
   G4int index = anE->GetIndex();
 
 // 100729 TK add safety
@@ -234,7 +245,7 @@ if ( ( ( *theCrossSections )( index ) )->GetVectorLength() == 0 ) return result;
         // Will take care after performance check.  
         // factor = factor * targetV;
      }
-     return ( (*((*theCrossSections)(index))).GetValue(eKinetic, outOfRange) )* factor; 
+     return LookUpCrossSection( index , eKinetic ) * factor; 
   }
 
   // prepare thermal nucleus
@@ -246,6 +257,13 @@ if ( ( ( *theCrossSections )( index ) )->GetVectorLength() == 0 ) return result;
   eleMass = ( G4NucleiProperties::GetNuclearMass( static_cast<G4int>(theA+eps) , static_cast<G4int>(theZ+eps) )
 	     ) / G4Neutron::Neutron()->GetPDGMass();
   
+  if ( dopplerQuadrature ) 
+  {
+     return G4ParticleHPDopplerBroadening::GetCrossSection( (*theCrossSections)(index) , 
+                ( theHashedGrids != NULL ) ? (*theHashedGrids)[index] : NULL ,
+                eKinetic , eleMass , aT*k_Boltzmann );
+  }
+
   G4ReactionProduct boosted;
   G4double aXsection;
   
@@ -265,7 +283,7 @@ if ( ( ( *theCrossSections )( index ) )->GetVectorLength() == 0 ) return result;
       G4ReactionProduct aThermalNuc = aNuc.GetThermalNucleus(eleMass, aT);
       boosted.Lorentz(theNeutronRP, aThermalNuc);
       G4double theEkin = boosted.GetKineticEnergy();
-      aXsection = (*((*theCrossSections)(index))).GetValue(theEkin, outOfRange);
+      aXsection = LookUpCrossSection( index , theEkin );
       // velocity correction.
       G4ThreeVector targetVelocity = 1./aThermalNuc.GetMass()*aThermalNuc.GetMomentum();
       aXsection *= (targetVelocity-neutronVelocity).mag()/neutronVMag;
@@ -0,0 +1,67 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// 19.10.2026 First implementation
+//
+#include "G4ParticleHPHashedGrid.hh"
+#include "G4PhysicsVector.hh"
+#include "G4Exp.hh"
+#include <algorithm>
+
+G4ParticleHPHashedGrid::G4ParticleHPHashedGrid(const G4PhysicsVector* vec)
+  : logEmin(0.0), invLogStep(0.0)
+{
+   size_t n = vec->GetVectorLength();
+   theEnergy.resize(n);
+   theValue.resize(n);
+   for ( size_t i = 0 ; i < n ; ++i ) {
+      theEnergy[i] = vec->Energy(i);
+      theValue[i] = (*vec)[i];
+   }
+   if ( n < 2 || theEnergy[0] <= 0.0 ) { 
+      theBucket.resize(1, 0);
+      return; 
+   }
+
+   // on average one node per bucket
+   size_t nb = n;
+   logEmin = G4Log(theEnergy[0]);
+   G4double logEmax = G4Log(theEnergy[n-1]);
+   invLogStep = ( logEmax > logEmin ) ? nb/(logEmax - logEmin) : 0.0;
+   theBucket.resize(nb);
+
+   // index of the last node strictly below the lower edge of the bucket
+   for ( size_t b = 0 ; b < nb ; ++b ) {
+      G4double e = ( 0.0 < invLogStep ) ? G4Exp(logEmin + b/invLogStep) 
+                                        : theEnergy[0];
+      size_t i = std::lower_bound(theEnergy.begin(), theEnergy.end(), e) 
+               - theEnergy.begin();
+      i = ( i > 0 ) ? i - 1 : 0; 
+      theBucket[b] = G4int(std::min(i, n-2));
+   }
+}
+
+G4ParticleHPHashedGrid::~G4ParticleHPHashedGrid()
+{}
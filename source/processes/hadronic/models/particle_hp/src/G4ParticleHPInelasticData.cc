@@ -38,6 +38,7 @@
 //
 #include "G4ParticleHPInelasticData.hh"
 #include "G4ParticleHPManager.hh"
+#include "G4ParticleHPDopplerBroadening.hh"
 #include "G4Neutron.hh"
 #include "G4ElementTable.hh"
 #include "G4ParticleHPData.hh"
@@ -92,7 +93,9 @@ G4ParticleHPInelasticData::G4ParticleHPInelasticData(G4ParticleDefinition* proje
   SetMaxKinEnergy( 20*CLHEP::MeV );                                   
 
    onFlightDB = true;
+   dopplerQuadrature = false;
    theCrossSections = 0;
+   theHashedGrids = NULL;
    theProjectile=projectile;
 
    theHPData = NULL;
@@ -174,8 +177,13 @@ void G4ParticleHPInelasticData::BuildPhysicsTable( const G4ParticleDefinition& p
       onFlightDB = false;
    }    
 
+   dopplerQuadrature = G4ParticleHPManager::GetInstance()->GetUseDopplerQuadrature();
+
    if ( G4Threading::IsWorkerThread() ) {
       theCrossSections = G4ParticleHPManager::GetInstance()->GetInelasticCrossSections( &projectile );
+      theHashedGrids = NULL;
+      if ( G4ParticleHPManager::GetInstance()->GetUseHashedEnergyGrid() )
+         theHashedGrids = G4ParticleHPManager::GetInstance()->GetHashedGrids( theCrossSections );
       return;
    } else {
       if ( theHPData == NULL ) theHPData = G4ParticleHPData::Instance( const_cast<G4ParticleDefinition*> ( &projectile ) ); 
@@ -208,6 +216,10 @@ void G4ParticleHPInelasticData::BuildPhysicsTable( const G4ParticleDefinition& p
   }
 
    G4ParticleHPManager::GetInstance()->RegisterInelasticCrossSections( &projectile , theCrossSections );
+
+   theHashedGrids = NULL;
+   if ( G4ParticleHPManager::GetInstance()->GetUseHashedEnergyGrid() )
+      theHashedGrids = G4ParticleHPManager::GetInstance()->BuildHashedGrids( theCrossSections );
 }
 
 void G4ParticleHPInelasticData::DumpPhysicsTable(const G4ParticleDefinition& projectile)
@@ -266,7 +278,6 @@ G4double G4ParticleHPInelasticData::
 GetCrossSection(const G4DynamicParticle* projectile, const G4Element*anE, G4double aT)
 {
   G4double result = 0;
-  G4bool outOfRange;
   G4int index = anE->GetIndex();
 
   // prepare neutron
@@ -283,7 +294,7 @@ GetCrossSection(const G4DynamicParticle* projectile, const G4Element*anE, G4doub
         // Will take care after performance check.  
         // factor = factor * targetV;
      }
-     return ( (*((*theCrossSections)(index))).GetValue(eKinetic, outOfRange) )* factor; 
+     return LookUpCrossSection( index , eKinetic ) * factor; 
 
   }   
 
@@ -299,6 +310,13 @@ GetCrossSection(const G4DynamicParticle* projectile, const G4Element*anE, G4doub
   G4double eleMass; 
   eleMass = G4NucleiProperties::GetNuclearMass(static_cast<G4int>(theA+eps), static_cast<G4int>(theZ+eps) );
   
+  if ( dopplerQuadrature ) 
+  {
+     return G4ParticleHPDopplerBroadening::GetCrossSection( (*theCrossSections)(index) , 
+                ( theHashedGrids != NULL ) ? (*theHashedGrids)[index] : NULL ,
+                eKinetic , eleMass/theProjectile->GetPDGMass() , aT*CLHEP::k_Boltzmann );
+  }
+
   G4ReactionProduct boosted;
   G4double aXsection;
   
@@ -323,7 +341,7 @@ GetCrossSection(const G4DynamicParticle* projectile, const G4Element*anE, G4doub
       G4ReactionProduct aThermalNuc = aNuc.GetThermalNucleus( eleMass/G4Neutron::Neutron()->GetPDGMass(), aT );
       boosted.Lorentz(theNeutron, aThermalNuc);
       G4double theEkin = boosted.GetKineticEnergy();
-      aXsection = (*((*theCrossSections)(index))).GetValue(theEkin, outOfRange);
+      aXsection = LookUpCrossSection( index , theEkin );
       //       G4cout << " G4ParticleHPInelasticData aXsection " << aXsection << " index " << index << " theEkin " << theEkin << " outOfRange " << outOfRange <<G4endl;//GDEB
      if(aXsection <0) 
       {
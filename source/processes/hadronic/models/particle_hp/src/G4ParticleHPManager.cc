@@ -33,6 +33,8 @@
 #include "G4ParticleHPThreadLocalManager.hh"
 #include "G4ParticleHPMessenger.hh"
 #include "G4HadronicException.hh"
+#include "G4ParticleHPHashedGrid.hh"
+#include "G4PhysicsTable.hh"
 
 //G4ThreadLocal G4ParticleHPManager* G4ParticleHPManager::instance = NULL;
 G4ParticleHPManager* G4ParticleHPManager::instance = G4ParticleHPManager::GetInstance();
@@ -45,6 +47,8 @@ G4ParticleHPManager::G4ParticleHPManager()
 ,NEGLECT_DOPPLER(false)
 ,DO_NOT_ADJUST_FINAL_STATE(false)
 ,PRODUCE_FISSION_FRAGMENTS(false)
+,USE_HASHED_ENERGY_GRID(false)
+,USE_DOPPLER_QUADRATURE(false)
 ,theElasticCrossSections(NULL)
 ,theCaptureCrossSections(NULL)
 //,theInelasticCrossSections(NULL)
@@ -66,10 +70,16 @@ G4ParticleHPManager::G4ParticleHPManager()
    if ( getenv( "G4NEUTRONHP_NEGLECT_DOPPLER" ) || getenv("G4PHP_NEGLECT_DOPPLER") ) NEGLECT_DOPPLER = true;
    if ( getenv( "G4NEUTRONHP_SKIP_MISSING_ISOTOPES" ) ) SKIP_MISSING_ISOTOPES = true;
    if ( getenv( "G4NEUTRONHP_PRODUCE_FISSION_FRAGMENTS" ) ) PRODUCE_FISSION_FRAGMENTS = true;
+   if ( getenv( "G4PHP_USE_HASHED_ENERGY_GRID" ) ) USE_HASHED_ENERGY_GRID = true;
+   if ( getenv( "G4PHP_DOPPLER_QUADRATURE" ) ) USE_DOPPLER_QUADRATURE = true;
 }
 G4ParticleHPManager::~G4ParticleHPManager()
 {
    delete messenger;
+   for ( auto it = theHashedGrids.begin() ; it != theHashedGrids.end() ; ++it ) {
+      for ( auto grid : *(it->second) ) { delete grid; }
+      delete it->second;
+   }
 }
 void G4ParticleHPManager::OpenReactionWhiteBoard()
 {
@@ -231,3 +241,31 @@ std::vector<G4ParticleHPChannelList*>* G4ParticleHPManager::GetInelasticFinalSta
 void G4ParticleHPManager::RegisterInelasticFinalStates( const G4ParticleDefinition* particle , std::vector<G4ParticleHPChannelList*>* val ) { 
    theInelasticFSs.insert ( std::pair<const G4ParticleDefinition*,std::vector<G4ParticleHPChannelList*>*>( particle , val ) ); 
 }
+
+std::vector<G4ParticleHPHashedGrid*>* G4ParticleHPManager::BuildHashedGrids( const G4PhysicsTable* table ) {
+   std::vector<G4ParticleHPHashedGrid*>* grids = GetHashedGrids( table );
+   if ( grids == NULL ) {
+      grids = new std::vector<G4ParticleHPHashedGrid*>;
+      theHashedGrids.insert( std::pair<const G4PhysicsTable*, std::vector<G4ParticleHPHashedGrid*>*>( table , grids ) );
+   }
+   // the table may have been rebuilt in place
+   for ( auto grid : *grids ) { delete grid; }
+   grids->clear();
+   size_t nNodes = 0;
+   for ( size_t i = 0 ; i < table->size() ; ++i ) {
+      grids->push_back( new G4ParticleHPHashedGrid( (*table)(i) ) );
+      nNodes += grids->back()->GetNumberOfNodes();
+   }
+   if ( verboseLevel > 1 ) {
+      G4cout << "G4ParticleHPManager: hashed energy grids for " << grids->size() 
+             << " elements with " << nNodes << " nodes are built" << G4endl; 
+   }
+   return grids;
+}
+
+std::vector<G4ParticleHPHashedGrid*>* G4ParticleHPManager::GetHashedGrids( const G4PhysicsTable* table ) {
+   if ( theHashedGrids.end() != theHashedGrids.find( table ) )
+      return theHashedGrids.find( table )->second;
+   else
+      return NULL;
+}
@@ -68,6 +68,21 @@ G4ParticleHPMessenger::G4ParticleHPMessenger( G4ParticleHPManager* man )
    ProduceFissionFragementCmd->SetCandidates("true false");
    ProduceFissionFragementCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
 
+   HashedEnergyGridCmd = new G4UIcmdWithAString("/process/had/particle_hp/use_hashed_energy_grid",this);
+   HashedEnergyGridCmd->SetGuidance("Use hashed log-energy buckets for the lookup of element cross sections.");
+   HashedEnergyGridCmd->SetGuidance("The grids are built at initialisation and shared between threads.");
+   HashedEnergyGridCmd->SetParameterName("choice",false);
+   HashedEnergyGridCmd->SetCandidates("true false");
+   HashedEnergyGridCmd->AvailableForStates(G4State_PreInit);
+
+   DopplerQuadratureCmd = new G4UIcmdWithAString("/process/had/particle_hp/use_Doppler_quadrature",this);
+   DopplerQuadratureCmd->SetGuidance("Compute the Doppler broadening of cross sections by a deterministic quadrature");
+   DopplerQuadratureCmd->SetGuidance("over the thermal motion of the target instead of Monte Carlo sampling.");
+   DopplerQuadratureCmd->SetGuidance("The cost per lookup is bounded and any material temperature is allowed.");
+   DopplerQuadratureCmd->SetParameterName("choice",false);
+   DopplerQuadratureCmd->SetCandidates("true false");
+   DopplerQuadratureCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
    VerboseCmd = new G4UIcmdWithAnInteger("/process/had/particle_hp/verbose",this);
    VerboseCmd->SetGuidance("Set Verbose level of ParticleHP package");
    VerboseCmd->SetParameterName("verbose_level",true);
@@ -84,6 +99,8 @@ G4ParticleHPMessenger::~G4ParticleHPMessenger()
    delete NeglectDopplerCmd;
    delete DoNotAdjustFSCmd;
    delete ProduceFissionFragementCmd;
+   delete HashedEnergyGridCmd;
+   delete DopplerQuadratureCmd;
    delete VerboseCmd;
 }
 
@@ -107,6 +124,12 @@ void G4ParticleHPMessenger::SetNewValue(G4UIcommand* command,G4String newValue)
    if ( command == ProduceFissionFragementCmd ) { 
       manager->SetProduceFissionFragments( bValue ); 
    }
+   if ( command == HashedEnergyGridCmd ) { 
+      manager->SetUseHashedEnergyGrid( bValue ); 
+   }
+   if ( command == DopplerQuadratureCmd ) { 
+      manager->SetUseDopplerQuadrature( bValue ); 
+   }
    if ( command == VerboseCmd ) {
       manager->SetVerboseLevel( VerboseCmd->ConvertToInt( newValue ) ); 
    }
@@ -45,6 +45,7 @@
 //  Correct treatment of the diffraction dissociation - 2012, V. Uzhinsky
 //  Mass distributions for resonances and uu-diquark suppression in protons,
 //  and dd-diquarks suppression in neutrons were introduced by V. Uzhinsky, 2014
+//  19.10.2026 Hadron lookups via per-thread G4StringParticleTable.
 // ---------------------------------------------------------------------
 
 #include "globals.hh"
@@ -61,6 +62,7 @@
 #include "G4ThreeVector.hh"
 #include "G4ParticleDefinition.hh" 
 #include "G4ParticleTable.hh"
+#include "G4StringParticleTable.hh"
 #include "G4SampleResonance.hh"
 #include "G4VSplitableHadron.hh"
 #include "G4ExcitedString.hh"
@@ -272,7 +274,7 @@ G4bool G4DiffractiveExcitation::ExciteParticipants( G4VSplitableHadron*    proje
   G4double ProbExc( 0.0 ); 
   if ( QeExc + QeNoExc != 0.0 ) ProbExc = QeExc/(QeExc + QeNoExc);
   G4double DeltaProbAtQuarkExchange = theParameters->GetDeltaProbAtQuarkExchange();
-  G4double DeltaMass = G4ParticleTable::GetParticleTable()->FindParticle( 2224 )->GetPDGMass();
+  G4double DeltaMass = G4StringParticleTable::GetInstance()->FindParticle( 2224 )->GetPDGMass();
 
   //ProbProjectileDiffraction = 0.5;
   //ProbTargetDiffraction     = 0.5;
@@ -463,7 +465,7 @@ G4bool G4DiffractiveExcitation::ExciteParticipants( G4VSplitableHadron*    proje
         #endif
 
         // Proj 
-        TestParticle = G4ParticleTable::GetParticleTable()->FindParticle( NewProjCode );
+        TestParticle = G4StringParticleTable::GetInstance()->FindParticle( NewProjCode );
         if ( ! TestParticle ) continue;
 
         //MminProjectile = TestParticle->GetPDGMass();
@@ -473,7 +475,7 @@ G4bool G4DiffractiveExcitation::ExciteParticipants( G4VSplitableHadron*    proje
 
         MtestPr = BrW.SampleMass( TestParticle, 
                                   TestParticle->GetPDGMass() + 5.0*TestParticle->GetPDGWidth() );
-        //G4ParticleTable::GetParticleTable()->FindParticle( NewProjCode )->GetPDGMass(); 
+        //G4StringParticleTable::GetInstance()->FindParticle( NewProjCode )->GetPDGMass(); 
 
         #ifdef debugFTFexictation
         G4cout << "TestParticle Name " << NewProjCode << " " << TestParticle->GetParticleName()<< G4endl;
@@ -510,7 +512,7 @@ G4bool G4DiffractiveExcitation::ExciteParticipants( G4VSplitableHadron*    proje
         } else {
         }
 
-        TestParticle = G4ParticleTable::GetParticleTable()->FindParticle( NewTargCode );
+        TestParticle = G4StringParticleTable::GetInstance()->FindParticle( NewTargCode );
 
         if ( ! TestParticle ) continue;
        
@@ -727,7 +729,7 @@ G4bool G4DiffractiveExcitation::ExciteParticipants( G4VSplitableHadron*    proje
         */
 
         // Proj 
-        TestParticle = G4ParticleTable::GetParticleTable()->FindParticle( NewProjCode );
+        TestParticle = G4StringParticleTable::GetInstance()->FindParticle( NewProjCode );
         if ( ! TestParticle ) continue;
 
         MminProjectile = BrW.GetMinimumMass( TestParticle );
@@ -738,7 +740,7 @@ G4bool G4DiffractiveExcitation::ExciteParticipants( G4VSplitableHadron*    proje
                                   TestParticle->GetPDGMass() + 5.0*TestParticle->GetPDGWidth() );
 
         // Targ 
-        TestParticle = G4ParticleTable::GetParticleTable()->FindParticle( NewTargCode );
+        TestParticle = G4StringParticleTable::GetInstance()->FindParticle( NewTargCode );
         if ( ! TestParticle ) continue;
 
         MminTarget = BrW.GetMinimumMass( TestParticle );
@@ -790,8 +792,8 @@ G4bool G4DiffractiveExcitation::ExciteParticipants( G4VSplitableHadron*    proje
 
     if ( PZcms2 < 0 ) return false;  // It can be if energy is not sufficient for Delta
 
-    projectile->SetDefinition( G4ParticleTable::GetParticleTable()->FindParticle( NewProjCode ) ); 
-    target->SetDefinition( G4ParticleTable::GetParticleTable()->FindParticle( NewTargCode ) ); 
+    projectile->SetDefinition( G4StringParticleTable::GetInstance()->FindParticle( NewProjCode ) ); 
+    target->SetDefinition( G4StringParticleTable::GetInstance()->FindParticle( NewTargCode ) ); 
 
     PZcms = std::sqrt( PZcms2 );
     Pprojectile.setPz( PZcms );
@@ -36,6 +36,7 @@
 //        make annihilation or re-orangement of quarks and anti-quarks.
 //     Ideas of Quark-Gluon-String model my A. Capella and A.B. Kaidalov
 //                       are implemented.
+//     19.10.2026 Hadron lookups via per-thread G4StringParticleTable.
 // ---------------------------------------------------------------------
 
 #include "globals.hh"
@@ -56,6 +57,7 @@
 #include "G4VSplitableHadron.hh"
 #include "G4ExcitedString.hh"
 #include "G4ParticleTable.hh"
+#include "G4StringParticleTable.hh"
 #include "G4Neutron.hh"
 #include "G4ParticleDefinition.hh"
 
@@ -317,7 +319,7 @@ G4bool G4FTFAnnihilation::Annihilate( G4VSplitableHadron* projectile,
       }
     }
 
-    G4ParticleDefinition* TestParticle = G4ParticleTable::GetParticleTable()->FindParticle( NewCode );
+    G4ParticleDefinition* TestParticle = G4StringParticleTable::GetInstance()->FindParticle( NewCode );
     if ( ! TestParticle ) return false;
     projectile->SetDefinition( TestParticle );
 
@@ -354,7 +356,7 @@ G4bool G4FTFAnnihilation::Annihilate( G4VSplitableHadron* projectile,
       }
     }
 
-    TestParticle = G4ParticleTable::GetParticleTable()->FindParticle( NewCode );
+    TestParticle = G4StringParticleTable::GetInstance()->FindParticle( NewCode );
     if ( ! TestParticle ) return false;
     target->SetDefinition( TestParticle );
 
@@ -389,7 +391,7 @@ G4bool G4FTFAnnihilation::Annihilate( G4VSplitableHadron* projectile,
       }
     }
 
-    TestParticle = G4ParticleTable::GetParticleTable()->FindParticle( NewCode );
+    TestParticle = G4StringParticleTable::GetInstance()->FindParticle( NewCode );
     if ( ! TestParticle ) return false;
     AdditionalString->SetDefinition( TestParticle );
 
@@ -811,7 +813,7 @@ G4bool G4FTFAnnihilation::Annihilate( G4VSplitableHadron* projectile,
         }
       }
 
-      G4ParticleDefinition* TestParticle = G4ParticleTable::GetParticleTable()->FindParticle( NewCode );
+      G4ParticleDefinition* TestParticle = G4StringParticleTable::GetInstance()->FindParticle( NewCode );
       if ( ! TestParticle ) return false;
       projectile->SetDefinition( TestParticle );
       theParameters->SetProjMinDiffMass( 0.5 );     // (0.5)  // GeV Uzhi March 2016 ?
@@ -848,7 +850,7 @@ G4bool G4FTFAnnihilation::Annihilate( G4VSplitableHadron* projectile,
         }
       }
 
-      TestParticle = G4ParticleTable::GetParticleTable()->FindParticle( NewCode );
+      TestParticle = G4StringParticleTable::GetInstance()->FindParticle( NewCode );
       if ( ! TestParticle ) return false;
       target->SetDefinition( TestParticle );
       theParameters->SetTarMinDiffMass( 0.5 );     // Uzhi March 2016 ?
@@ -1131,7 +1133,7 @@ G4bool G4FTFAnnihilation::Annihilate( G4VSplitableHadron* projectile,
         }
       }
 
-      G4ParticleDefinition* TestParticle = G4ParticleTable::GetParticleTable()->FindParticle( NewCode );
+      G4ParticleDefinition* TestParticle = G4StringParticleTable::GetInstance()->FindParticle( NewCode );
       if ( ! TestParticle ) return false;
       projectile->SetDefinition( TestParticle );
       theParameters->SetProjMinDiffMass( 0.5 );     // (0.5)  // GeV Uzhi March 2016
@@ -37,6 +37,7 @@
 //
 //                Vladimir Uzhinsky, November - December 2012
 //       simulation of nucleus-nucleus interactions was implemented.
+//                19.10.2026 Hadron lookups via per-thread G4StringParticleTable.
 // ------------------------------------------------------------
 
 #include <utility> 
@@ -52,6 +53,7 @@
 #include "G4LorentzRotation.hh"
 #include "G4ParticleDefinition.hh"
 #include "G4ParticleTable.hh"
+#include "G4StringParticleTable.hh"
 #include "G4IonTable.hh"
 #include "G4KineticTrack.hh"
 
@@ -3029,7 +3031,7 @@ GenerateDeltaIsobar( const G4double sqrtS,                  // input parameter
       G4int newPdgCode = pdgCode/10; newPdgCode = newPdgCode*10 + 4; // Delta
       if ( splitableHadron->GetDefinition()->GetPDGEncoding() < 0 ) newPdgCode *= -1;
       const G4ParticleDefinition* ptr = 
-        G4ParticleTable::GetParticleTable()->FindParticle( newPdgCode );
+        G4StringParticleTable::GetInstance()->FindParticle( newPdgCode );
       splitableHadron->SetDefinition( ptr );
       G4double massDelta = std::sqrt( sqr( splitableHadron->GetDefinition()->GetPDGMass() )
                                       + splitableHadron->Get4Momentum().perp2() );
@@ -32,6 +32,7 @@
 //      History: 
 //             Gunter Folger, August/September 2001
 //               Create class; 
+//             19.10.2026 Add IsDiQuark()
 // -----------------------------------------------------------------------------
 //
 
@@ -65,6 +66,10 @@ class G4HadronBuilder
      G4ParticleDefinition * Meson(G4ParticleDefinition * black, G4ParticleDefinition * white, Spin spin);
 
      G4ParticleDefinition * Barion(G4ParticleDefinition * black, G4ParticleDefinition * white, Spin spin);
+
+     // Partons on string ends are quarks (|PDG| < 10) or diquarks (|PDG| > 1000)
+     static G4bool IsDiQuark(const G4ParticleDefinition * parton)
+     { return std::abs(parton->GetPDGEncoding()) > 1000; }
      
      G4double mesonSpinMix;
      G4double barionSpinMix;
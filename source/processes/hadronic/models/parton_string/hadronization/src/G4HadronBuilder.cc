@@ -32,13 +32,15 @@
 //      History: 
 //             Gunter Folger, August/September 2001
 //               Create class; algorithm previously in G4VLongitudinalStringDecay.
+//             19.10.2026 Hadron lookup via per-thread G4StringParticleTable;
+//               diquarks recognised by PDG code, not by sub-type string.
 // -----------------------------------------------------------------------------
 
 #include "G4HadronBuilder.hh"
 #include "G4SystemOfUnits.hh"
 #include "Randomize.hh"
 #include "G4HadronicException.hh"
-#include "G4ParticleTable.hh"
+#include "G4StringParticleTable.hh"
 
 G4HadronBuilder::G4HadronBuilder(G4double mesonMix, G4double barionMix,
 		     std::vector<double> scalarMesonMix,
@@ -53,7 +55,7 @@ G4HadronBuilder::G4HadronBuilder(G4double mesonMix, G4double barionMix,
 G4ParticleDefinition * G4HadronBuilder::Build(G4ParticleDefinition * black, G4ParticleDefinition * white)
 {
 
-	if (black->GetParticleSubType()== "di_quark" || white->GetParticleSubType()== "di_quark" ) {
+	if ( IsDiQuark(black) || IsDiQuark(white) ) {
 
            // Baryon
 	   Spin spin = (G4UniformRand() < barionSpinMix) ? SpinHalf : SpinThreeHalf;
@@ -72,7 +74,7 @@ G4ParticleDefinition * G4HadronBuilder::Build(G4ParticleDefinition * black, G4Pa
 
 G4ParticleDefinition * G4HadronBuilder::BuildLowSpin(G4ParticleDefinition * black, G4ParticleDefinition * white)
 {
-	if ( black->GetParticleSubType()== "quark" && white->GetParticleSubType()== "quark" ) {
+	if ( !IsDiQuark(black) && !IsDiQuark(white) ) {
 		return Meson(black,white, SpinZero);
 	} else {
                 // will return a SpinThreeHalf Baryon if all quarks the same
@@ -84,7 +86,7 @@ G4ParticleDefinition * G4HadronBuilder::BuildLowSpin(G4ParticleDefinition * blac
 
 G4ParticleDefinition * G4HadronBuilder::BuildHighSpin(G4ParticleDefinition * black, G4ParticleDefinition * white)
 {
-	if ( black->GetParticleSubType()== "quark" && white->GetParticleSubType()== "quark" ) {
+	if ( !IsDiQuark(black) && !IsDiQuark(white) ) {
 		return Meson(black,white, SpinOne);
 	} else {
 		return Barion(black,white,SpinThreeHalf);
@@ -147,7 +149,7 @@ G4ParticleDefinition * G4HadronBuilder::Meson(G4ParticleDefinition * black,
  	}
 	      
 	G4ParticleDefinition * MesonDef=
-		G4ParticleTable::GetParticleTable()->FindParticle(PDGEncoding);
+		G4StringParticleTable::GetInstance()->FindParticle(PDGEncoding);
 
         #ifdef G4VERBOSE
 	if (MesonDef == 0 ) {
@@ -246,7 +248,7 @@ G4ParticleDefinition * G4HadronBuilder::Barion(G4ParticleDefinition * black,
 	if (id1 < 0)   PDGEncoding = -PDGEncoding;
 
 	G4ParticleDefinition * BarionDef=
-		G4ParticleTable::GetParticleTable()->FindParticle(PDGEncoding);
+		G4StringParticleTable::GetInstance()->FindParticle(PDGEncoding);
 
         #ifdef G4VERBOSE
 	if (BarionDef == 0 ) {
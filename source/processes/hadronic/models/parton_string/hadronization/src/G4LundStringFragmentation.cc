@@ -31,6 +31,7 @@
 //      GEANT 4 class implementation file
 //
 //      History: first implementation, Maxim Komogorov, 10-Jul-1998
+//               19.10.2026 Last-splitting hadrons via cached FindParticle
 // -----------------------------------------------------------------------------
 #include "G4LundStringFragmentation.hh"
 #include "G4PhysicalConstants.hh"
@@ -666,7 +667,7 @@ G4bool G4LundStringFragmentation::SplitLast(G4FragmentingString * string,
   #endif
 
   G4LorentzVector Str4Mom=string->Get4Momentum();
-  G4ThreeVector ClusterVel=string->Get4Momentum().boostVector();
+  G4ThreeVector ClusterVel=Str4Mom.boostVector();
   G4double StringMass=string->Mass();
 
   G4ParticleDefinition * LeftHadron(0), * RightHadron(0);
@@ -1142,7 +1143,7 @@ Diquark_AntiDiquark_aboveThreshold_lastSplitting(G4FragmentingString * & string,
     G4int loopCounter = 0;
     do
     {
-      LeftHadron=G4ParticleTable::GetParticleTable()->FindParticle(
+      LeftHadron=FindParticle(
 			-Baryon[ADi_q1-1][ADi_q2-1][ProdQ-1][StateADiQ]);
       G4double LeftHadronMass=LeftHadron->GetPDGMass();
 
@@ -1153,7 +1154,7 @@ Diquark_AntiDiquark_aboveThreshold_lastSplitting(G4FragmentingString * & string,
       G4int internalLoopCounter = 0;
       do
       {
-        RightHadron=G4ParticleTable::GetParticleTable()->FindParticle(
+        RightHadron=FindParticle(
 			+Baryon[Di_q1-1][Di_q2-1][ProdQ-1][StateDiQ]);
 	G4double RightHadronMass=RightHadron->GetPDGMass();
 
@@ -1255,7 +1256,7 @@ Quark_Diquark_lastSplitting(G4FragmentingString * & string,
     G4int loopCounter = 0;
     do
     {
-      LeftHadron=G4ParticleTable::GetParticleTable()->FindParticle(
+      LeftHadron=FindParticle(
                        SignQ*Meson[AbsIDquark-1][ProdQ-1][StateQ]);
       G4double LeftHadronMass=LeftHadron->GetPDGMass();
 
@@ -1264,7 +1265,7 @@ Quark_Diquark_lastSplitting(G4FragmentingString * & string,
       G4int internalLoopCounter = 0;
       do
       {
-	RightHadron=G4ParticleTable::GetParticleTable()->FindParticle(
+	RightHadron=FindParticle(
                           SignDiQ*Baryon[Di_q1-1][Di_q2-1][ProdQ-1][StateDiQ]);
 	G4double RightHadronMass=RightHadron->GetPDGMass();
 
@@ -1353,7 +1354,7 @@ Quark_AntiQuark_lastSplitting(G4FragmentingString * & string,
     G4int loopCounter = 0;
     do
     {
-      LeftHadron=G4ParticleTable::GetParticleTable()->FindParticle(
+      LeftHadron=FindParticle(
                        SignQ*Meson[AbsIDquark-1][ProdQ-1][StateQ]);
       G4double LeftHadronMass=LeftHadron->GetPDGMass();
 
@@ -1362,7 +1363,7 @@ Quark_AntiQuark_lastSplitting(G4FragmentingString * & string,
       G4int internalLoopCounter = 0;
       do
       {
-        RightHadron=G4ParticleTable::GetParticleTable()->FindParticle(
+        RightHadron=FindParticle(
                           SignAQ*Meson[AbsIDanti_quark-1][ProdQ-1][StateAQ]);
 	G4double RightHadronMass=RightHadron->GetPDGMass();
 
@@ -31,6 +31,7 @@
 //
 //      History: first implementation, Maxim Komogorov, 1-Jul-1998
 //               redesign  Gunter Folger, August/September 2001
+//               19.10.2026 FindParticle uses per-thread G4StringParticleTable
 // -----------------------------------------------------------------------------
 #include "G4VLongitudinalStringDecay.hh"
 #include "G4PhysicalConstants.hh"
@@ -45,6 +46,7 @@
 #include "G4VShortLivedParticle.hh"
 #include "G4ShortLivedConstructor.hh"
 #include "G4ParticleTable.hh"
+#include "G4StringParticleTable.hh"
 #include "G4PhaseSpaceDecayChannel.hh"
 #include "G4VDecayChannel.hh"
 #include "G4DecayTable.hh"
@@ -261,7 +263,7 @@ FragmentationMass( const G4FragmentingString * const string, Pcreate build, pDef
 
 G4ParticleDefinition* G4VLongitudinalStringDecay::FindParticle(G4int Encoding) 
 {
-  G4ParticleDefinition* ptr = G4ParticleTable::GetParticleTable()->FindParticle(Encoding);
+  G4ParticleDefinition* ptr = G4StringParticleTable::GetInstance()->FindParticle(Encoding);
   if (ptr == NULL)
   {
     G4cout << "Particle with encoding "<<Encoding<<" does not exist!!!"<<G4endl;
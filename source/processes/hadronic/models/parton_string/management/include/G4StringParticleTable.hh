@@ -0,0 +1,87 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// G4StringParticleTable
+//
+// Per-thread lookup of particle definitions by PDG code for the string
+// models.  Codes whose decimal digits are all below 6 and |code| < 10000
+// (quarks, diquarks, and light/strange/charm/bottom mesons and baryons)
+// are kept in a flat array, filled on first successful lookup in
+// G4ParticleTable.  Other codes are passed on to G4ParticleTable.
+//
+// 19.10.2026 First implementation
+// -----------------------------------------------------------------------------
+
+#ifndef G4StringParticleTable_h
+#define G4StringParticleTable_h 1
+
+#include "globals.hh"
+#include "G4ThreadLocalSingleton.hh"
+
+class G4ParticleDefinition;
+
+class G4StringParticleTable
+{
+  friend class G4ThreadLocalSingleton<G4StringParticleTable>;
+
+  public:
+    static G4StringParticleTable* GetInstance();
+
+    inline G4ParticleDefinition* FindParticle(G4int aPDGEncoding);
+
+  private:
+    G4StringParticleTable();
+    ~G4StringParticleTable();
+
+    G4StringParticleTable(const G4StringParticleTable &right);
+    const G4StringParticleTable & operator=(const G4StringParticleTable &right);
+
+    G4ParticleDefinition* Fill(G4int aPDGEncoding, G4int index);
+
+    enum { nDigits = 6, nCodes = nDigits*nDigits*nDigits*nDigits };
+
+    static G4ThreadLocal G4StringParticleTable* theInstance;
+
+    G4ParticleDefinition* theDefinitions[2*nCodes];
+};
+
+inline G4ParticleDefinition*
+G4StringParticleTable::FindParticle(G4int aPDGEncoding)
+{
+  G4int code  = std::abs(aPDGEncoding);
+  G4int index = -1;
+  if (code > 0 && code < 10000) {
+    G4int d0 = code%10, d1 = (code/10)%10, d2 = (code/100)%10, d3 = code/1000;
+    if (d0 < nDigits && d1 < nDigits && d2 < nDigits && d3 < nDigits) {
+      index = ((d3*nDigits + d2)*nDigits + d1)*nDigits + d0;
+      if (aPDGEncoding < 0) index += nCodes;
+      if (theDefinitions[index]) return theDefinitions[index];
+    }
+  }
+  return Fill(aPDGEncoding, index);
+}
+
+#endif
@@ -51,6 +51,7 @@ GEANT4_DEFINE_MODULE(NAME G4had_string_man
         G4InteractionContent.hh
         G4PomeronCrossSection.hh
         G4StringModel.hh
+        G4StringParticleTable.hh
         G4VParticipants.hh
         G4VPartonStringModel.hh
         G4VSplitableHadron.hh
@@ -61,6 +62,7 @@ GEANT4_DEFINE_MODULE(NAME G4had_string_man
         G4InteractionContent.cc
         G4PomeronCrossSection.cc
         G4StringModel.cc
+        G4StringParticleTable.cc
         G4VParticipants.cc
         G4VPartonStringModel.cc
         G4VSplitableHadron.cc
@@ -0,0 +1,63 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// G4StringParticleTable
+//
+// 19.10.2026 First implementation
+// -----------------------------------------------------------------------------
+
+#include "G4StringParticleTable.hh"
+#include "G4ParticleTable.hh"
+
+G4ThreadLocal G4StringParticleTable* G4StringParticleTable::theInstance = 0;
+
+G4StringParticleTable* G4StringParticleTable::GetInstance()
+{
+  if (!theInstance) {
+    static G4ThreadLocalSingleton<G4StringParticleTable> inst;
+    theInstance = inst.Instance();
+  }
+  return theInstance;
+}
+
+G4StringParticleTable::G4StringParticleTable()
+{
+  for (G4int i=0; i<2*nCodes; i++) theDefinitions[i] = 0;
+}
+
+G4StringParticleTable::~G4StringParticleTable()
+{}
+
+G4ParticleDefinition* 
+G4StringParticleTable::Fill(G4int aPDGEncoding, G4int index)
+{
+  G4ParticleDefinition* ptr = 
+    G4ParticleTable::GetParticleTable()->FindParticle(aPDGEncoding);
+
+  // Unknown codes are not remembered: the particle table may still grow
+  if (index >= 0) theDefinitions[index] = ptr;
+  return ptr;
+}
@@ -78,7 +78,7 @@ class G4QGSMSplitableHadron : public G4VSplitableHadron
   private:
     // associated classes
     G4MesonSplitter theMesonSplitter;
-    G4BaryonSplitter theBaryonSplitter;
+    static G4BaryonSplitter* GetBaryonSplitter();  // shared per thread
 
   private:
     // model parameters
@@ -26,9 +26,11 @@
 // Split barion (antibarion) into quark and diquark (antidiquark and antiqaurk ) 
 // based on prototype, needs clean up of interfaces HPW Feb 1999  
 // Numbers verified and errors corrected, HPW Dec 1999
+// 19.10.2026 Per-call lookups use G4StringParticleTable
 
 #include "G4BaryonSplitter.hh"
 #include "G4ParticleTable.hh"
+#include "G4StringParticleTable.hh"
 
 G4BaryonSplitter::
 G4BaryonSplitter()
@@ -74,7 +76,7 @@ G4BaryonSplitter()
 G4bool G4BaryonSplitter::
 SplitBarion(G4int PDGCode, G4int* q_or_qqbar, G4int* qbar_or_qq)
 {
-  const G4SPBaryon * aBaryon = theBaryons.GetBaryon(G4ParticleTable::GetParticleTable()->FindParticle(PDGCode));
+  const G4SPBaryon * aBaryon = theBaryons.GetBaryon(G4StringParticleTable::GetInstance()->FindParticle(PDGCode));
 
   if(aBaryon==NULL)
   {
@@ -90,7 +92,7 @@ SplitBarion(G4int PDGCode, G4int* q_or_qqbar, G4int* qbar_or_qq)
 const G4SPBaryon & G4BaryonSplitter::
 GetSPBaryon(G4int PDGCode)
 {
-  return *theBaryons.GetBaryon(G4ParticleTable::GetParticleTable()->FindParticle(PDGCode));
+  return *theBaryons.GetBaryon(G4StringParticleTable::GetInstance()->FindParticle(PDGCode));
 }
 
 
@@ -98,7 +100,7 @@ GetSPBaryon(G4int PDGCode)
 G4bool G4BaryonSplitter::
 FindDiquark(G4int PDGCode, G4int Quark, G4int* Diquark)
 {
-  const G4SPBaryon * aBaryon = theBaryons.GetBaryon(G4ParticleTable::GetParticleTable()->FindParticle(PDGCode));
+  const G4SPBaryon * aBaryon = theBaryons.GetBaryon(G4StringParticleTable::GetInstance()->FindParticle(PDGCode));
   if(aBaryon)
   {
     aBaryon->FindDiquark(Quark, *Diquark);
@@ -36,6 +36,7 @@
 
 #include "G4Log.hh"
 #include "G4Pow.hh"
+#include "G4ThreadLocalSingleton.hh"
 
 
 // based on prototype by Maxim Komogorov
@@ -51,6 +52,14 @@
 // Removed the ordering problem. No Direction needed in selection of valence quark types. HPW Mar'99.
 // Fixing p-t distributions for scattering of nuclei.
 // Separating out parameters.
+// 19.10.2026 Baryon splitter (an immutable table of G4SPBaryon) is built
+//            once per thread instead of once per splitable hadron.
+
+G4BaryonSplitter* G4QGSMSplitableHadron::GetBaryonSplitter()
+{
+  static G4ThreadLocalSingleton<G4BaryonSplitter> inst;
+  return inst.Instance();
+}
 
 void G4QGSMSplitableHadron::InitParameters()
 {
@@ -322,7 +331,7 @@ GetValenceQuarkFlavors(const G4ParticleDefinition * aPart, G4Parton *& Parton1,
   {
     theMesonSplitter.SplitMeson(HadronEncoding, &aEnd, &bEnd);
   } else {
-    theBaryonSplitter.SplitBarion(HadronEncoding, &aEnd, &bEnd);
+    GetBaryonSplitter()->SplitBarion(HadronEncoding, &aEnd, &bEnd);
   }
 
   Parton1 = new G4Parton(aEnd);
@@ -40,6 +40,8 @@
 //
 // CHANGE HISTORY
 // --------------
+// 19 October 2026 - shared cache of decay rate tables with optional file
+//
 // 17 October 2011, L Desorgher - Add the method AddUserDecayDataFile
 //
 // 01 June 2011, M. Kelsey -- Add directional biasing interface to allow for
@@ -76,6 +78,7 @@ class G4RadioactiveDecaymessenger;
 typedef std::vector<G4RadioactiveDecayRateVector> G4RadioactiveDecayRateTable;
 typedef std::vector<G4RadioactiveDecayRate> G4RadioactiveDecayRates;
 typedef std::map<G4String, G4DecayTable*> DecayTableMap;
+typedef std::map<G4String, G4RadioactiveDecayRateVector> DecayRateTableMap;
 
 
 class G4RadioactiveDecay : public G4VRestDiscreteProcess 
@@ -163,6 +166,12 @@ class G4RadioactiveDecay : public G4VRestDiscreteProcess
     // Allow the user to replace the radio-active decay data provided in Geant4
     // by its own data file for a given isotope
 
+    void SetDecayRateTableFile(const G4String& filename);
+    // Decay rate tables (VR mode) are retrieved from this file at 
+    // initialisation and all tables computed in the run are written 
+    // to it at the end of the job.  The file should not be reused 
+    // after a change of the decay data.
+
 
     inline void  SetVerboseLevel(G4int value) {verboseLevel = value;}
     // Sets the VerboseLevel which controls duggering display
@@ -277,6 +286,13 @@ class G4RadioactiveDecay : public G4VRestDiscreteProcess
 
     G4NucleusLimits theNucleusLimits;
 
+    // Key of the decay rate table in the cache shared between threads,
+    // the table depends on the nucleus limits and the h-l threshold
+    G4String RateTableKey(const G4ParticleDefinition&) const;
+
+    void RetrieveDecayRateTables();
+    void StoreDecayRateTables();
+
     G4bool isInitialised;
     G4bool AnalogueMC;
     G4bool BRBias;
@@ -306,6 +322,12 @@ class G4RadioactiveDecay : public G4VRestDiscreteProcess
     G4RadioactiveDecayRates theDecayRateVector;
     G4RadioactiveDecayRateVector theDecayRateTable;
     G4RadioactiveDecayRateTable theDecayRateTableVector;
+    std::map<G4String, size_t> theDecayRateTableIndex;
+
+    // decay rate tables shared between threads
+    static DecayRateTableMap* master_rateTables;
+    static G4bool rateTablesUpdated;
+    G4String rateTableFile;
 
     // for the radioactivity tables
     std::vector<G4RadioactivityTable*> theRadioactivityTables;
@@ -110,6 +110,7 @@ public: //with description
   G4UIcmdWithABool               *icmCmd;
   G4UIcmdWithABool               *armCmd;
   G4UIcmdWithADoubleAndUnit      *hlthCmd;
+  G4UIcmdWithAString             *rateTableFileCmd;
 
   G4UIcommand					 *userDecayDataCmd;
   G4UIcommand					 *userEvaporationDataCmd;
@@ -44,6 +44,9 @@
 // CHANGE HISTORY
 // --------------
 //
+// 19 Oct  2026, decay rate tables are cached and shared between threads,
+//               optionally retrieved from and stored to a file
+//
 // 13 Oct  2015, L.G. Sarmiento Neutron emission added
 //
 // 06 Aug  2014, L.G. Sarmiento Proton decay mode added mimicking the alpha decay
@@ -144,6 +147,7 @@
 #include <sstream>
 #include <algorithm>
 #include <fstream>
+#include <iomanip>
 // #include "G4PhotonEvaporation.hh"
 
 using namespace CLHEP;
@@ -158,6 +162,8 @@ const G4ThreeVector G4RadioactiveDecay::origin(0.,0.,0.);
 G4Mutex G4RadioactiveDecay::radioactiveDecayMutex = G4MUTEX_INITIALIZER;
 DecayTableMap* G4RadioactiveDecay::master_dkmap = 0;
 #endif
+DecayRateTableMap* G4RadioactiveDecay::master_rateTables = 0;
+G4bool G4RadioactiveDecay::rateTablesUpdated = false;
 
 G4RadioactiveDecay::G4RadioactiveDecay(const G4String& processName)
  : G4VRestDiscreteProcess(processName, fDecay), isInitialised(false),
@@ -183,6 +189,7 @@ G4RadioactiveDecay::G4RadioactiveDecay(const G4String& processName)
   G4AutoLock lk(&G4RadioactiveDecay::radioactiveDecayMutex);
   if(!master_dkmap) master_dkmap = new DecayTableMap;
 #endif
+  if(!master_rateTables) master_rateTables = new DecayRateTableMap;
   dkmap = new DecayTableMap;
 
   // Apply default values.
@@ -215,6 +222,9 @@ G4RadioactiveDecay::G4RadioactiveDecay(const G4String& processName)
 
 G4RadioactiveDecay::~G4RadioactiveDecay()
 {
+  if(rateTableFile != "" && G4Threading::IsMasterThread()) { 
+    StoreDecayRateTables(); 
+  }
   delete theRadioactiveDecaymessenger;
   for (DecayTableMap::iterator i = dkmap->begin(); i != dkmap->end(); i++) {
     delete i->second;
@@ -355,12 +365,22 @@ G4bool
 G4RadioactiveDecay::IsRateTableReady(const G4ParticleDefinition& aParticle)
 {
   // Check whether the radioactive decay rates table for the ion has already
-  // been calculated.
+  // been calculated by this or by another thread
   G4String aParticleName = aParticle.GetParticleName();
-  for (size_t i = 0; i < theDecayRateTableVector.size(); i++) {
-    if (theDecayRateTableVector[i].GetIonName() == aParticleName) return true;
-  }
-  return false;
+  if (theDecayRateTableIndex.find(aParticleName) != 
+      theDecayRateTableIndex.end()) { return true; }
+
+  G4String key = RateTableKey(aParticle);
+#ifdef G4MULTITHREADED
+  G4AutoLock lk(&G4RadioactiveDecay::radioactiveDecayMutex);
+#endif
+  DecayRateTableMap::const_iterator it = master_rateTables->find(key);
+  if (it == master_rateTables->end()) { return false; }
+
+  theDecayRateTableIndex[aParticleName] = theDecayRateTableVector.size();
+  theDecayRateTableVector.push_back(it->second);
+  theDecayRateTableVector.back().SetIonName(aParticleName);
+  return true;
 }
 
 // GetDecayRateTable
@@ -371,10 +391,10 @@ G4RadioactiveDecay::GetDecayRateTable(const G4ParticleDefinition& aParticle)
 {
   G4String aParticleName = aParticle.GetParticleName();
 
-  for (size_t i = 0; i < theDecayRateTableVector.size(); i++) {
-    if (theDecayRateTableVector[i].GetIonName() == aParticleName) {
-      theDecayRateVector = theDecayRateTableVector[i].GetItsRates();
-    }
+  std::map<G4String, size_t>::const_iterator it = 
+    theDecayRateTableIndex.find(aParticleName);
+  if (it != theDecayRateTableIndex.end()) {
+    theDecayRateVector = theDecayRateTableVector[it->second].GetItsRates();
   }
 #ifdef G4VERBOSE
   if (GetVerboseLevel() > 0) {
@@ -384,6 +404,123 @@ G4RadioactiveDecay::GetDecayRateTable(const G4ParticleDefinition& aParticle)
 #endif
 }
 
+G4String 
+G4RadioactiveDecay::RateTableKey(const G4ParticleDefinition& aParticle) const
+{
+  // the threshold is written with full precision, so that tables
+  // for close but different thresholds have different keys
+  std::ostringstream os;
+  os << std::setprecision(17) << aParticle.GetParticleName() << "/" 
+     << theNucleusLimits.GetAMin() << "/" << theNucleusLimits.GetAMax() << "/"
+     << theNucleusLimits.GetZMin() << "/" << theNucleusLimits.GetZMax() << "/"
+     << halflifethreshold/ns;
+  return os.str();
+}
+
+void G4RadioactiveDecay::SetDecayRateTableFile(const G4String& filename)
+{
+  rateTableFile = filename;
+}
+
+// Text format of the decay rate table file:
+//   number of tables 
+//   for each table: key, number of rates
+//   for each rate: Z A E generation n coefficients n lifetimes
+
+void G4RadioactiveDecay::RetrieveDecayRateTables()
+{
+  std::ifstream in(rateTableFile);
+  if (!in.good()) { return; }
+  std::size_t ntab = 0;
+  in >> ntab;
+  std::size_t nadded = 0;
+  std::vector<G4double> coeffs;
+  std::vector<G4double> times;
+  G4RadioactiveDecayRates rates;
+  G4RadioactiveDecayRate rate;
+  for (std::size_t i = 0; i < ntab && !in.fail(); ++i) {
+    G4String key;
+    std::size_t nrates = 0;
+    in >> key >> nrates;
+    rates.clear();
+    for (std::size_t j = 0; j < nrates && !in.fail(); ++j) {
+      G4int Z(0), A(0), gen(0);
+      G4double E(0.0);
+      std::size_t n = 0;
+      in >> Z >> A >> E >> gen >> n;
+      coeffs.resize(n);
+      times.resize(n);
+      for (std::size_t k = 0; k < n; ++k) { in >> coeffs[k]; }
+      for (std::size_t k = 0; k < n; ++k) { in >> times[k]; }
+      rate.SetZ(Z);
+      rate.SetA(A);
+      rate.SetE(E*keV);
+      rate.SetGeneration(gen);
+      rate.SetDecayRateC(coeffs);
+      rate.SetTaos(times);
+      rates.push_back(rate);
+    }
+    if (in.fail()) { break; }
+    G4RadioactiveDecayRateVector table;
+    table.SetItsRates(rates);
+    if (master_rateTables->insert(std::make_pair(key, table)).second) { 
+      ++nadded; 
+    }
+  }
+  if (in.fail()) {
+    G4ExceptionDescription ed;
+    ed << "File " << rateTableFile << " is corrupted, " << nadded
+       << " decay rate tables are retrieved";
+    G4Exception("G4RadioactiveDecay::RetrieveDecayRateTables()", 
+                "HAD_RDM_012", JustWarning, ed);
+  } else if (GetVerboseLevel() > 0) {
+    G4cout << "G4RadioactiveDecay: " << nadded 
+           << " decay rate tables are retrieved from " << rateTableFile
+           << G4endl;
+  }
+}
+
+void G4RadioactiveDecay::StoreDecayRateTables()
+{
+#ifdef G4MULTITHREADED
+  G4AutoLock lk(&G4RadioactiveDecay::radioactiveDecayMutex);
+#endif
+  if (!rateTablesUpdated) { return; }
+  std::ofstream out(rateTableFile);
+  if (!out.good()) {
+    G4ExceptionDescription ed;
+    ed << "Decay rate tables cannot be written to " << rateTableFile;
+    G4Exception("G4RadioactiveDecay::StoreDecayRateTables()", 
+                "HAD_RDM_014", JustWarning, ed);
+    return;
+  }
+  out << std::setprecision(17) << master_rateTables->size() << "\n";
+  DecayRateTableMap::const_iterator it = master_rateTables->begin();
+  for (; it != master_rateTables->end(); ++it) {
+    G4RadioactiveDecayRates rates = it->second.GetItsRates();
+    out << it->first << " " << rates.size() << "\n";
+    for (std::size_t j = 0; j < rates.size(); ++j) {
+      std::vector<G4double> coeffs = rates[j].GetDecayRateC();
+      std::vector<G4double> times = rates[j].GetTaos();
+      out << rates[j].GetZ() << " " << rates[j].GetA() << " "
+          << rates[j].GetE()/keV << " " << rates[j].GetGeneration() << " "
+          << coeffs.size();
+      for (std::size_t k = 0; k < coeffs.size(); ++k) { 
+        out << " " << coeffs[k]; 
+      }
+      for (std::size_t k = 0; k < times.size(); ++k) { 
+        out << " " << times[k]; 
+      }
+      out << "\n";
+    }
+  }
+  rateTablesUpdated = false;
+  if (GetVerboseLevel() > 0) {
+    G4cout << "G4RadioactiveDecay: " << master_rateTables->size()
+           << " decay rate tables are stored in " << rateTableFile << G4endl;
+  }
+}
+
 // ConvolveSourceTimeProfile performs the convolution of the source time profile
 // function with a single exponential characterized by a decay constant in the 
 // decay chain.  The time profile is treated as a step function so that the 
@@ -739,6 +876,10 @@ void G4RadioactiveDecay::BuildPhysicsTable(const G4ParticleDefinition&)
       */
     }
 
+    if (rateTableFile != "" && G4Threading::IsMasterThread()) {
+      RetrieveDecayRateTables();
+    }
+
     G4DeexPrecoParameters* param = G4NuclearLevelData::GetInstance()->GetParameters();
     param->SetUseFilesNEW(true);
     //param->SetCorrelatedGamma(true);  //AR-20Feb2017: Temporary, to fix non-reproducibility problems
@@ -1448,7 +1589,18 @@ G4RadioactiveDecay::AddDecayRateTable(const G4ParticleDefinition& theParentNucle
   theDecayRateTable.SetItsRates(theDecayRateVector);
 
   // finally add the decayratetable to the tablevector
+  theDecayRateTableIndex[theParentNucleus.GetParticleName()] = 
+    theDecayRateTableVector.size();
   theDecayRateTableVector.push_back(theDecayRateTable);
+
+  // and share it with other threads
+  G4String key = RateTableKey(theParentNucleus);
+#ifdef G4MULTITHREADED
+  G4AutoLock lk(&G4RadioactiveDecay::radioactiveDecayMutex);
+#endif
+  if (master_rateTables->insert(std::make_pair(key, theDecayRateTable)).second) {
+    rateTablesUpdated = true;
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -174,6 +174,15 @@ G4RadioactiveDecaymessenger::G4RadioactiveDecaymessenger
   splitnucleiCmd->SetDefaultValue(1);
   splitnucleiCmd->SetRange("NSplit>=1");
 
+  //
+  // This command defines the file of precomputed decay rate tables
+  //
+  rateTableFileCmd = new G4UIcmdWithAString("/grdm/decayRateTableFile",this);
+  rateTableFileCmd->SetGuidance("Retrieve decay rate tables (VR mode) from this file");
+  rateTableFileCmd->SetGuidance("and store tables computed in the job to it at exit");
+  rateTableFileCmd->SetParameterName("RateTableFile",false);
+  rateTableFileCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
   //
   // This command setup the verbose level of radioactive decay
   //
@@ -234,6 +243,7 @@ G4RadioactiveDecaymessenger::~G4RadioactiveDecaymessenger ()
   delete icmCmd;
   delete armCmd;
   delete hlthCmd;
+  delete rateTableFileCmd;
   delete userDecayDataCmd;
   delete userEvaporationDataCmd;
   delete colldirCmd;
@@ -279,6 +289,9 @@ void G4RadioactiveDecaymessenger::SetNewValue (G4UIcommand *command, G4String ne
   else if (command==hlthCmd ) {theRadioactiveDecayContainer->
       SetHLThreshold(hlthCmd->GetNewDoubleValue(newValues));
 
+  } else if (command==rateTableFileCmd ) {theRadioactiveDecayContainer->
+      SetDecayRateTableFile(newValues);
+
   } else if (command ==userDecayDataCmd){
     G4int Z,A;
     G4String file_name;
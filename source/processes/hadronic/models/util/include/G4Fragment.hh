@@ -44,6 +44,7 @@
 //            removed not needed 'const'; removed old debug staff and unused
 //            private methods; add comments and reorder methods for 
 //            better reading
+// 19.10.2026 added per-thread counter of allocations
 
 #ifndef G4Fragment_h
 #define G4Fragment_h 1
@@ -98,6 +99,9 @@ public:
   inline void *operator new(size_t);
   inline void operator delete(void *aFragment);
 
+  // number of fragments allocated in this thread
+  static G4long GetNumberOfAllocations();
+
   // ============= GENERAL METHODS ==================
 
   inline G4int GetZ_asInt() const;
@@ -227,13 +231,16 @@ inline void G4Fragment::SetNuclearPolarization(G4NuclearPolarization* p)
 
 #if defined G4HADRONIC_ALLOC_EXPORT
   extern G4DLLEXPORT G4ThreadLocal G4Allocator<G4Fragment> *pFragmentAllocator;
+  extern G4DLLEXPORT G4ThreadLocal G4long nFragmentAllocations;
 #else
   extern G4DLLIMPORT G4ThreadLocal G4Allocator<G4Fragment> *pFragmentAllocator;
+  extern G4DLLIMPORT G4ThreadLocal G4long nFragmentAllocations;
 #endif
 
 inline void * G4Fragment::operator new(size_t)
 {
   if (!pFragmentAllocator) { pFragmentAllocator = new G4Allocator<G4Fragment>; }
+  ++nFragmentAllocations;
   return (void*) pFragmentAllocator->MallocSingle();
 }
 
@@ -30,6 +30,7 @@
 //      GEANT 4 class header file
 //
 //      History: first implementation, A. Feliciello, 20th May 1998
+//      19.10.2026 enabled G4Allocator and per-thread allocation counter
 // -----------------------------------------------------------------------------
 
 #ifndef G4KineticTrack_h
@@ -50,7 +51,7 @@
 #include "G4VDecayChannel.hh"
 #include "G4Log.hh"
 
-// #include "G4Allocator.hh"
+#include "G4Allocator.hh"
 
 class G4KineticTrackVector;
 
@@ -77,10 +78,14 @@ class G4KineticTrack : public G4VKineticNucleon
       G4int operator==(const G4KineticTrack& right) const;
 
       G4int operator!=(const G4KineticTrack& right) const;
-/*
+
+      //  new/delete operators are overloded to use G4Allocator
       inline void *operator new(size_t);
       inline void operator delete(void *aTrack);
-*/
+
+      // number of objects allocated in this thread
+      static G4long GetNumberOfAllocations();
+
       const G4ParticleDefinition* GetDefinition() const;
       void SetDefinition(const G4ParticleDefinition* aDefinition);
 
@@ -189,23 +194,29 @@ public:
       G4double theProjectilePotential;
 };
 
-// extern G4Allocator<G4KineticTrack> theKTAllocator;
-
+#if defined G4HADRONIC_ALLOC_EXPORT
+  extern G4DLLEXPORT G4ThreadLocal G4Allocator<G4KineticTrack> *pKineticTrackAllocator;
+  extern G4DLLEXPORT G4ThreadLocal G4long nKineticTrackAllocations;
+#else
+  extern G4DLLIMPORT G4ThreadLocal G4Allocator<G4KineticTrack> *pKineticTrackAllocator;
+  extern G4DLLIMPORT G4ThreadLocal G4long nKineticTrackAllocations;
+#endif
 
 // Class G4KineticTrack 
-/*
+
 inline void * G4KineticTrack::operator new(size_t)
 {
-  void * aT;
-  aT = (void *) theKTAllocator.MallocSingle();
-  return aT;
+  if (!pKineticTrackAllocator) { 
+    pKineticTrackAllocator = new G4Allocator<G4KineticTrack>; 
+  }
+  ++nKineticTrackAllocations;
+  return (void*) pKineticTrackAllocator->MallocSingle();
 }
 
 inline void G4KineticTrack::operator delete(void * aT)
 {
-  theKTAllocator.FreeSingle((G4KineticTrack *) aT);
+  pKineticTrackAllocator->FreeSingle((G4KineticTrack *) aT);
 }
-*/
 
 inline const G4ParticleDefinition* G4KineticTrack::GetDefinition() const
 {
@@ -37,6 +37,7 @@
 //            inline to source 
 // 25.09.2010 M. Kelsey -- Change "setprecision" to "setwidth" in printout,
 //	      add null pointer check.
+// 19.10.2026 added per-thread counter of allocations
 
 #include "G4Fragment.hh"
 #include "G4HadronicException.hh"
@@ -44,8 +45,14 @@
 #include <iomanip>
 
 G4ThreadLocal G4Allocator<G4Fragment> *pFragmentAllocator = nullptr;
+G4ThreadLocal G4long nFragmentAllocations = 0;
 const G4double G4Fragment::minFragExcitation = 10.*CLHEP::eV;
 
+G4long G4Fragment::GetNumberOfAllocations()
+{
+  return nFragmentAllocations;
+}
+
 // Default constructor
 G4Fragment::G4Fragment() :
   theA(0),
@@ -60,6 +60,14 @@
 
 static G4ThreadLocal G4double  G4KineticTrack_Gmass, G4KineticTrack_xmass1;
 
+G4ThreadLocal G4Allocator<G4KineticTrack> *pKineticTrackAllocator = nullptr;
+G4ThreadLocal G4long nKineticTrackAllocations = 0;
+
+G4long G4KineticTrack::GetNumberOfAllocations()
+{
+  return nKineticTrackAllocations;
+}
+
 //
 //   Default constructor
 //
@@ -30,6 +30,7 @@
 // modified by H.P.Wellisch to add functionality needed by string models,
 // cascade and Nucleus. (Mon Mar 16 1998) 
 // M. Kelsey 29-Aug-2011 -- Use G4Allocator model to avoid memory churn.
+// 19-Oct-2026 -- Per-thread counter of allocations
  
 #ifndef G4ReactionProduct_h
 #define G4ReactionProduct_h 1
@@ -46,8 +47,10 @@ class G4ReactionProduct;
 //
 #if defined G4HADRONIC_ALLOC_EXPORT
   extern G4DLLEXPORT G4ThreadLocal G4Allocator<G4ReactionProduct> *aRPAllocator;
+  extern G4DLLEXPORT G4ThreadLocal G4long nRPAllocations;
 #else
   extern G4DLLIMPORT G4ThreadLocal G4Allocator<G4ReactionProduct> *aRPAllocator;
+  extern G4DLLIMPORT G4ThreadLocal G4long nRPAllocations;
 #endif
 
 class G4ReactionProduct
@@ -81,6 +84,7 @@ class G4ReactionProduct
     // Override new and delete for use with G4Allocator
     inline void* operator new(size_t) {
       if (!aRPAllocator) aRPAllocator = new G4Allocator<G4ReactionProduct>  ;
+      ++nRPAllocations;
       return (void *)aRPAllocator->MallocSingle();
     }
 #ifdef __IBMCPP__
@@ -92,6 +96,9 @@ class G4ReactionProduct
       aRPAllocator->FreeSingle((G4ReactionProduct*)aReactionProduct);
     }
 
+    // Number of objects allocated in this thread
+    static G4long GetNumberOfAllocations() { return nRPAllocations; }
+
     G4ReactionProduct &operator= ( const G4ReactionProduct &right );
     
     G4ReactionProduct &operator= ( const G4DynamicParticle &right );
@@ -27,10 +27,12 @@
 // last modified: 19-Dec-1996
 // Modified by J.L.Chuma, 05-May-97
 // M. Kelsey 29-Aug-2011 -- Use G4Allocator for better memory management
+// 19-Oct-2026 -- Per-thread counter of allocations
 
 #include "G4ReactionProduct.hh"
 
 G4ThreadLocal G4Allocator<G4ReactionProduct> *aRPAllocator = 0;
+G4ThreadLocal G4long nRPAllocations = 0;
 
 
  G4ReactionProduct::G4ReactionProduct() :
@@ -0,0 +1,223 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// $Id$
+//
+//
+//---------------------------------------------------------------
+//
+//  G4WoodcockTrackingModel.hh
+//
+//  Description:
+//    Fast simulation model transporting neutral particles (gamma
+//    and neutron by default) through the envelope region with
+//    Woodcock (delta) tracking: flight distances are sampled with
+//    the majorant of the macroscopic cross section over all the
+//    materials of the region, so that the boundaries of the
+//    daughter volumes (e.g. the voxels of a phantom) are never
+//    crossed. At each tentative collision point the material is
+//    located and the collision is accepted as real with probability
+//    Sigma(material)/Sigma_max, otherwise it is fictitious and the
+//    flight goes on.
+//
+//    The majorant is tabulated in logarithmic energy bins and is an
+//    upper bound of the total cross section in each bin: for the
+//    G4VEmProcess with lambda tables it is the exact maximum of the
+//    interpolated tables (including spline overshoot); the other
+//    cross sections (hadronic data sets, EM processes without tables)
+//    are tabulated by the model on a grid 8 times finer and linearly
+//    interpolated, and these tabulated values are used everywhere in
+//    the envelope, so that their maximum is at the grid nodes. Outside
+//    of the energy grid the majorant is computed exactly at the
+//    energy of the particle. A cross section above the majorant is
+//    a fatal error, since it can only come from a material which is
+//    not in the envelope region.
+//
+//    Cross sections are read from the processes of the particle
+//    without changing their state: G4VEmProcess::GetLambda,
+//    G4VEnergyLossProcess::GetLambda and the cross section data
+//    store of G4HadronicProcess (cross section scale factors of
+//    hadronic processes are not applied). Other discrete processes
+//    (e.g. decay) are ignored inside the envelope, with a warning.
+//    A real collision is performed by the PostStepDoIt of the
+//    selected process, in a separate fast step started at the
+//    collision point (so that the energy deposit and the secondaries
+//    belong to the right volume). The sampled collision is attached
+//    to the track as auxiliary information and is only performed if
+//    the next step of the track starts at the collision point. When
+//    the particle leaves the envelope the numbers of interaction
+//    lengths left of its processes are resampled.
+//
+//    The model is switched on for a region by constructing it with
+//    this region as envelope, and can be (in)activated with the
+//    /param/ commands. The G4FastSimulationManagerProcess must be
+//    registered for the concerned particles. All daughter volumes
+//    of the envelope are expected to belong to the envelope region.
+//
+//  History:
+//    Oct 2026: First Implementation.
+//    19.10.2026: Read-only cross sections, majorant as an upper bound
+//                of the interpolated cross sections, pending collision
+//                attached to the track.
+//
+//---------------------------------------------------------------
+
+
+#ifndef G4WoodcockTrackingModel_h
+#define G4WoodcockTrackingModel_h 1
+
+#include "G4VFastSimulationModel.hh"
+#include <vector>
+
+class G4Navigator;
+class G4Step;
+class G4VProcess;
+class G4MaterialCutsCouple;
+class G4VEmProcess;
+class G4VEnergyLossProcess;
+class G4HadronicProcess;
+class G4PhysicsVector;
+
+
+class G4WoodcockTrackingModel : public G4VFastSimulationModel
+{
+public: // With description
+
+  G4WoodcockTrackingModel(const G4String& aName, G4Envelope* anEnvelope);
+  // The envelope region is the region in which Woodcock tracking
+  // is used.
+
+  virtual ~G4WoodcockTrackingModel();
+
+  virtual G4bool IsApplicable(const G4ParticleDefinition&);
+  // True for the particles in the list of PDG codes (gamma and
+  // neutron by default).
+
+  virtual G4bool ModelTrigger(const G4FastTrack&);
+  // True unless the particle is leaving the envelope.
+
+  virtual void DoIt(const G4FastTrack&, G4FastStep&);
+  // Flight to the next real collision or to the envelope exit, or
+  // execution of a pending real collision.
+
+  void AddParticle(G4int pdg);
+  // Adds a neutral particle to which the model applies.
+
+  void SetMajorantBinning(G4double emin, G4double emax, G4int nbins);
+  // Energy grid of the majorant tables; outside of it the majorant
+  // and the cross sections are computed on the fly.
+
+  void ResetMajorants();
+  // To be called if the materials of the region or the physics
+  // tables change between runs.
+
+  void SetVerboseLevel(G4int val)       { fVerboseLevel = val; }
+
+  G4int GetNumberOfRealCollisions() const       { return fNReal; }
+  G4int GetNumberOfFictitiousCollisions() const { return fNFictitious; }
+  // Counters for the current thread, useful to tune the region.
+
+private:
+
+  struct G4WoodcockParticleData
+  {
+    const G4ParticleDefinition* particle;
+    // processes with a cross section, and their type (one of the
+    // three pointers is set for each of them)
+    std::vector<G4VProcess*> processes;
+    std::vector<G4VEmProcess*> emProcesses;
+    std::vector<G4VEnergyLossProcess*> elossProcesses;
+    std::vector<G4HadronicProcess*> hadProcesses;
+    // discrete processes ignored inside the envelope
+    std::vector<G4VProcess*> ignored;
+    // true for the processes bounded from their own lambda tables,
+    // the cross sections of the others are tabulated by the model
+    // for each couple of the region in 'tables' (process*nCouples+couple)
+    std::vector<G4bool> bounded;
+    std::vector<G4PhysicsVector*> tables;
+    std::vector<G4double> majorant;
+  };
+
+  G4WoodcockTrackingModel(const G4WoodcockTrackingModel&);
+  G4WoodcockTrackingModel& operator=(const G4WoodcockTrackingModel&);
+
+  G4WoodcockParticleData* GetParticleData(const G4ParticleDefinition*);
+  void BuildMajorant(G4WoodcockParticleData*);
+  void BuildTables(G4WoodcockParticleData*);
+  G4double GetMajorant(G4WoodcockParticleData*, G4double ekin);
+
+  G4double ComputeCrossSections(G4WoodcockParticleData*,
+                                const G4MaterialCutsCouple*);
+  // Fills fSigma with the macroscopic cross section of each process
+  // for the probe track and the couple, and returns their sum; the
+  // tabulated values are used for the processes which are not bounded.
+
+  G4double ComputeCrossSection(G4WoodcockParticleData*, size_t idx,
+                               const G4MaterialCutsCouple*);
+  // Cross section of one process computed by the process.
+
+  G4int GetCoupleIndex(const G4MaterialCutsCouple*) const;
+  // Index of the couple in fCouples; a couple of a material which is
+  // not in the envelope region is a fatal error.
+
+  void ResetInteractionLengths(G4WoodcockParticleData*);
+  // Resamples the number of interaction lengths left of the processes
+  // of the particle, whose GPIL are not called inside the envelope.
+
+  void SetProbe(const G4Track&);
+  const G4MaterialCutsCouple* LocateCouple(const G4ThreeVector& position,
+                                           const G4ThreeVector& direction);
+  void DoRealCollision(const G4FastTrack&, G4FastStep&);
+
+private:
+
+  G4Envelope* fEnvelope;
+  std::vector<G4int> fParticles;
+  std::vector<const G4MaterialCutsCouple*> fCouples;
+  std::vector<G4int> fCoupleIndex;
+  std::vector<G4WoodcockParticleData*> fParticleData;
+  std::vector<G4double> fSigma;
+
+  // Identifier of the auxiliary track information holding the
+  // pending real collision of a track
+  G4int fModelID;
+
+  G4Navigator* fNavigator;
+  G4bool fNavigatorLocated;
+  G4Track* fProbeTrack;
+  G4Step* fProbeStep;
+
+  G4double fMinEnergy;
+  G4double fMaxEnergy;
+  G4int fNBins;
+  G4double fInvLogBinWidth;
+
+  G4int fVerboseLevel;
+  G4int fNReal;
+  G4int fNFictitious;
+};
+
+#endif
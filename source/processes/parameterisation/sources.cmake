@@ -28,7 +28,18 @@ include_directories(${CMAKE_SOURCE_DIR}/source/global/HEPRandom/include)
 include_directories(${CMAKE_SOURCE_DIR}/source/global/management/include)
 include_directories(${CMAKE_SOURCE_DIR}/source/intercoms/include)
 include_directories(${CMAKE_SOURCE_DIR}/source/materials/include)
+include_directories(${CMAKE_SOURCE_DIR}/source/particles/bosons/include)
+include_directories(${CMAKE_SOURCE_DIR}/source/particles/hadrons/barions/include)
+include_directories(${CMAKE_SOURCE_DIR}/source/particles/hadrons/ions/include)
+include_directories(${CMAKE_SOURCE_DIR}/source/particles/hadrons/mesons/include)
+include_directories(${CMAKE_SOURCE_DIR}/source/particles/leptons/include)
 include_directories(${CMAKE_SOURCE_DIR}/source/particles/management/include)
+include_directories(${CMAKE_SOURCE_DIR}/source/processes/cuts/include)
+include_directories(${CMAKE_SOURCE_DIR}/source/processes/electromagnetic/utils/include)
+include_directories(${CMAKE_SOURCE_DIR}/source/processes/hadronic/cross_sections/include)
+include_directories(${CMAKE_SOURCE_DIR}/source/processes/hadronic/management/include)
+include_directories(${CMAKE_SOURCE_DIR}/source/processes/hadronic/models/management/include)
+include_directories(${CMAKE_SOURCE_DIR}/source/processes/hadronic/util/include)
 include_directories(${CMAKE_SOURCE_DIR}/source/processes/management/include)
 include_directories(${CMAKE_SOURCE_DIR}/source/track/include)
 
@@ -50,6 +61,7 @@ GEANT4_DEFINE_MODULE(NAME G4parameterisation
         G4FastTrack.hh
         G4GlobalFastSimulationManager.hh
         G4VFastSimulationModel.hh
+        G4WoodcockTrackingModel.hh
     SOURCES
         G4FastSimulationHelper.cc
         G4FastSimulationManager.cc
@@ -59,9 +71,14 @@ GEANT4_DEFINE_MODULE(NAME G4parameterisation
         G4FastTrack.cc
         G4GlobalFastSimulationManager.cc
         G4VFastSimulationModel.cc
+        G4WoodcockTrackingModel.cc
     GRANULAR_DEPENDENCIES
+        G4cuts
+        G4emutils
         G4geometrymng
         G4globman
+        G4hadronic_mgt
+        G4hadronic_xsect
         G4intercoms
         G4magneticfield
         G4materials
@@ -0,0 +1,700 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// $Id$
+//
+//
+//---------------------------------------------------------------
+//
+//  G4WoodcockTrackingModel.cc
+//
+//  Description:
+//    Woodcock (delta) tracking of neutral particles in an envelope.
+//
+//  History:
+//    Oct 2026: First Implementation.
+//    19.10.2026: Read-only cross sections, majorant as an upper bound
+//                of the interpolated cross sections, pending collision
+//                attached to the track.
+//
+//---------------------------------------------------------------
+
+#include "G4WoodcockTrackingModel.hh"
+
+#include "G4PhysicalConstants.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Log.hh"
+#include "G4Exp.hh"
+#include "Randomize.hh"
+#include "G4Track.hh"
+#include "G4Step.hh"
+#include "G4StepPoint.hh"
+#include "G4DynamicParticle.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4ProcessManager.hh"
+#include "G4ProcessVector.hh"
+#include "G4VProcess.hh"
+#include "G4VParticleChange.hh"
+#include "G4VEmProcess.hh"
+#include "G4VEnergyLossProcess.hh"
+#include "G4HadronicProcess.hh"
+#include "G4CrossSectionDataStore.hh"
+#include "G4PhysicsTable.hh"
+#include "G4PhysicsVector.hh"
+#include "G4PhysicsLogVector.hh"
+#include "G4PhysicsModelCatalog.hh"
+#include "G4VAuxiliaryTrackInformation.hh"
+#include "G4Navigator.hh"
+#include "G4TransportationManager.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4LogicalVolume.hh"
+#include "G4VSolid.hh"
+#include "G4Region.hh"
+#include "G4Material.hh"
+#include "G4MaterialCutsCouple.hh"
+#include "G4ProductionCutsTable.hh"
+#include "G4GeometryTolerance.hh"
+
+#include <algorithm>
+
+namespace
+{
+  // Number of grid points per majorant bin for the tabulated cross sections
+  const G4int nSubBins = 8;
+  // Relative margin covering the rounding in the bound of the interpolants
+  const G4double roundingMargin = 1.e-6;
+
+  // The model identifier is registered when the library is loaded, i.e.
+  // on the master thread, since the models are usually constructed on
+  // the worker threads only
+  const G4int woodcockModelID =
+    G4PhysicsModelCatalog::Register("G4WoodcockTrackingModel");
+
+  // Real collision sampled at the end of a fast step, to be performed
+  // at the beginning of the next step of the track
+  class G4WoodcockCollisionInfo : public G4VAuxiliaryTrackInformation
+  {
+  public:
+    G4WoodcockCollisionInfo() : stepNumber(-1) {}
+    virtual ~G4WoodcockCollisionInfo() {}
+
+    G4ThreeVector position;
+    G4int stepNumber;  // fast step which sampled the collision, -1 if none
+  };
+
+  G4bool IsPendingCollision(const G4WoodcockCollisionInfo* info,
+                            const G4Track* track)
+  {
+    if(!info || info->stepNumber < 0) { return false; }
+    G4double tol = G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
+    return (track->GetCurrentStepNumber() == info->stepNumber + 1 &&
+            (info->position - track->GetPosition()).mag2() < tol*tol);
+  }
+}
+
+G4WoodcockTrackingModel::G4WoodcockTrackingModel(const G4String& aName,
+                                                 G4Envelope* anEnvelope)
+  : G4VFastSimulationModel(aName, anEnvelope),
+    fEnvelope(anEnvelope),
+    fModelID(woodcockModelID),
+    fNavigator(0),
+    fNavigatorLocated(false),
+    fProbeTrack(0),
+    fProbeStep(0),
+    fMinEnergy(0.0),
+    fMaxEnergy(0.0),
+    fNBins(0),
+    fInvLogBinWidth(0.0),
+    fVerboseLevel(0),
+    fNReal(0),
+    fNFictitious(0)
+{
+  fParticles.push_back(22);
+  fParticles.push_back(2112);
+  SetMajorantBinning(1.e-5*eV, 100.*TeV, 380);
+}
+
+G4WoodcockTrackingModel::~G4WoodcockTrackingModel()
+{
+  ResetMajorants();
+  delete fNavigator;
+  delete fProbeTrack;
+  delete fProbeStep;
+}
+
+G4bool G4WoodcockTrackingModel::IsApplicable(const G4ParticleDefinition& part)
+{
+  if(part.GetPDGCharge() != 0.0) { return false; }
+  return std::find(fParticles.begin(), fParticles.end(),
+                   part.GetPDGEncoding()) != fParticles.end();
+}
+
+void G4WoodcockTrackingModel::AddParticle(G4int pdg)
+{
+  if(std::find(fParticles.begin(), fParticles.end(), pdg) == fParticles.end())
+  {
+    fParticles.push_back(pdg);
+  }
+}
+
+void G4WoodcockTrackingModel::SetMajorantBinning(G4double emin,
+                                                 G4double emax, G4int nbins)
+{
+  if(emin <= 0.0 || emax <= emin || nbins <= 0) { return; }
+  fMinEnergy = emin;
+  fMaxEnergy = emax;
+  fNBins = nbins;
+  fInvLogBinWidth = nbins/G4Log(emax/emin);
+  ResetMajorants();
+}
+
+void G4WoodcockTrackingModel::ResetMajorants()
+{
+  for(size_t i=0; i<fParticleData.size(); ++i)
+  {
+    G4WoodcockParticleData* data = fParticleData[i];
+    for(size_t j=0; j<data->tables.size(); ++j) { delete data->tables[j]; }
+    delete data;
+  }
+  fParticleData.clear();
+  fCouples.clear();
+  fCoupleIndex.clear();
+}
+
+G4bool G4WoodcockTrackingModel::ModelTrigger(const G4FastTrack& fastTrack)
+{
+  const G4Track* track = fastTrack.GetPrimaryTrack();
+  if(IsPendingCollision(static_cast<const G4WoodcockCollisionInfo*>(
+       track->GetAuxiliaryTrackInformation(fModelID)), track))
+  {
+    return true;
+  }
+  // Leave the particle to the normal tracking when it exits the envelope
+  G4double dOut = fastTrack.GetEnvelopeSolid()->
+    DistanceToOut(fastTrack.GetPrimaryTrackLocalPosition(),
+                  fastTrack.GetPrimaryTrackLocalDirection());
+  return dOut > G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
+}
+
+void G4WoodcockTrackingModel::DoIt(const G4FastTrack& fastTrack,
+                                   G4FastStep& fastStep)
+{
+  const G4Track* track = fastTrack.GetPrimaryTrack();
+
+  // A real collision was sampled at the end of the previous fast step:
+  // perform it now that the track is located in the right volume. A
+  // collision left by a track which did not resume at the collision
+  // point at its next step is dropped.
+  G4WoodcockCollisionInfo* info = static_cast<G4WoodcockCollisionInfo*>(
+    track->GetAuxiliaryTrackInformation(fModelID));
+  G4bool pending = IsPendingCollision(info, track);
+  if(info) { info->stepNumber = -1; }
+  if(pending)
+  {
+    DoRealCollision(fastTrack, fastStep);
+    return;
+  }
+
+  G4WoodcockParticleData* data =
+    GetParticleData(track->GetParticleDefinition());
+  G4double ekin = track->GetKineticEnergy();
+  SetProbe(*track);
+  G4double sigmaMax = GetMajorant(data, ekin);
+
+  G4double dOut = fastTrack.GetEnvelopeSolid()->
+    DistanceToOut(fastTrack.GetPrimaryTrackLocalPosition(),
+                  fastTrack.GetPrimaryTrackLocalDirection());
+
+  const G4ThreeVector& start = track->GetPosition();
+  const G4ThreeVector& dir = track->GetMomentumDirection();
+  G4double length = 0.0;
+  G4bool real = false;
+
+  // Loop checking: each iteration advances by a strictly positive
+  // distance towards the envelope exit
+  while(sigmaMax > 0.0)
+  {
+    G4double flight = -G4Log(G4UniformRand())/sigmaMax;
+    if(length + flight >= dOut) { break; }
+    length += flight;
+
+    G4ThreeVector pos = start + length*dir;
+    const G4MaterialCutsCouple* couple = LocateCouple(pos, dir);
+    if(!couple) { break; }
+
+    fProbeTrack->SetPosition(pos);
+    G4double sigma = ComputeCrossSections(data, couple);
+    if(sigma > sigmaMax)
+    {
+      // The majorant is an upper bound of the cross sections of the
+      // couples of the region: the flight cannot be trusted
+      G4ExceptionDescription ed;
+      ed << "Cross section of " << data->particle->GetParticleName()
+         << " in " << couple->GetMaterial()->GetName()
+         << " at " << ekin/MeV << " MeV exceeds the majorant of region "
+         << fEnvelope->GetName() << " by "
+         << (sigma/sigmaMax - 1.0)*100. << " %.";
+      G4Exception("G4WoodcockTrackingModel::DoIt()", "FastSim012",
+                  FatalException, ed);
+    }
+    if(G4UniformRand()*sigmaMax < sigma)
+    {
+      real = true;
+      break;
+    }
+    ++fNFictitious;
+  }
+  if(!real)
+  {
+    length = dOut;
+    ResetInteractionLengths(data);
+  }
+
+  G4ThreeVector end = start + length*dir;
+  fastStep.ProposePrimaryTrackFinalPosition(end, false);
+  fastStep.ProposePrimaryTrackPathLength(length);
+
+  G4double mass = track->GetParticleDefinition()->GetPDGMass();
+  G4double mom = std::sqrt(ekin*(ekin + 2.0*mass));
+  if(mom > 0.0)
+  {
+    fastStep.ProposePrimaryTrackFinalTime(track->GetGlobalTime()
+                                          + length*(ekin + mass)/(mom*c_light));
+    fastStep.ProposePrimaryTrackFinalProperTime(track->GetProperTime()
+                                                + length*mass/(mom*c_light));
+  }
+
+  if(real)
+  {
+    if(!info)
+    {
+      info = new G4WoodcockCollisionInfo();
+      track->SetAuxiliaryTrackInformation(fModelID, info);
+    }
+    info->position = end;
+    info->stepNumber = track->GetCurrentStepNumber();
+  }
+}
+
+void G4WoodcockTrackingModel::DoRealCollision(const G4FastTrack& fastTrack,
+                                              G4FastStep& fastStep)
+{
+  const G4Track* track = fastTrack.GetPrimaryTrack();
+  G4WoodcockParticleData* data =
+    GetParticleData(track->GetParticleDefinition());
+
+  SetProbe(*track);
+  if(data->majorant.empty()) { BuildMajorant(data); }
+  fProbeTrack->SetTouchableHandle(track->GetTouchableHandle());
+  fProbeStep->InitializeStep(fProbeTrack);
+
+  // the couple of the pre-step point is the one of parameterised volumes
+  const G4MaterialCutsCouple* couple = track->GetMaterialCutsCouple();
+  G4StepPoint* pre = fProbeStep->GetPreStepPoint();
+  pre->SetMaterial(const_cast<G4Material*>(couple->GetMaterial()));
+  pre->SetMaterialCutsCouple(couple);
+  *(fProbeStep->GetPostStepPoint()) = *pre;
+  G4double sigma = ComputeCrossSections(data, couple);
+  if(sigma <= 0.0) { return; }
+
+  G4double x = G4UniformRand()*sigma;
+  size_t idx = 0;
+  size_t nproc = data->processes.size();
+  for(; idx<nproc-1; ++idx)
+  {
+    x -= fSigma[idx];
+    if(x < 0.0) { break; }
+  }
+  ++fNReal;
+
+  G4VParticleChange* change =
+    data->processes[idx]->PostStepDoIt(*fProbeTrack, *fProbeStep);
+  change->UpdateStepForPostStep(fProbeStep);
+  G4StepPoint* post = fProbeStep->GetPostStepPoint();
+
+  G4int nsec = change->GetNumberOfSecondaries();
+  fastStep.SetNumberOfSecondaryTracks(nsec);
+  for(G4int i=0; i<nsec; ++i)
+  {
+    G4Track* sec = change->GetSecondary(i);
+    fastStep.CreateSecondaryTrack(*(sec->GetDynamicParticle()),
+                                  sec->GetPosition(),
+                                  sec->GetGlobalTime(), false);
+    delete sec;
+  }
+  change->Clear();
+
+  fastStep.ProposeTotalEnergyDeposited(fProbeStep->GetTotalEnergyDeposit());
+  fastStep.ProposePrimaryTrackPathLength(0.0);
+  if(post->GetWeight() != track->GetWeight())
+  {
+    fastStep.ProposePrimaryTrackFinalEventBiasingWeight(post->GetWeight());
+  }
+
+  G4TrackStatus status = change->GetTrackStatus();
+  if(status == fStopAndKill)
+  {
+    fastStep.KillPrimaryTrack();
+  }
+  else
+  {
+    fastStep.ProposePrimaryTrackFinalKineticEnergyAndDirection(
+      post->GetKineticEnergy(), post->GetMomentumDirection(), false);
+    fastStep.ProposePrimaryTrackFinalPolarization(post->GetPolarization(),
+                                                  false);
+    if(status != fAlive) { fastStep.ProposeTrackStatus(status); }
+  }
+}
+
+G4WoodcockTrackingModel::G4WoodcockParticleData*
+G4WoodcockTrackingModel::GetParticleData(const G4ParticleDefinition* part)
+{
+  for(size_t i=0; i<fParticleData.size(); ++i)
+  {
+    if(fParticleData[i]->particle == part) { return fParticleData[i]; }
+  }
+
+  // Discrete physics processes of the particle, as in the
+  // process manager of the current thread
+  G4WoodcockParticleData* data = new G4WoodcockParticleData;
+  data->particle = part;
+  G4ProcessManager* pm = part->GetProcessManager();
+  G4ProcessVector* pv = pm->GetPostStepProcessVector(typeDoIt);
+  for(G4int i=0; i<pv->entries(); ++i)
+  {
+    G4VProcess* proc = (*pv)[i];
+    if(!proc || !pm->GetProcessActivation(proc)) { continue; }
+    G4ProcessType type = proc->GetProcessType();
+    if(type != fElectromagnetic && type != fOptical && type != fHadronic &&
+       type != fPhotolepton_hadron && type != fDecay) { continue; }
+
+    G4VEmProcess* em = dynamic_cast<G4VEmProcess*>(proc);
+    G4VEnergyLossProcess* eloss = dynamic_cast<G4VEnergyLossProcess*>(proc);
+    G4HadronicProcess* had = dynamic_cast<G4HadronicProcess*>(proc);
+    if(em || eloss || had)
+    {
+      data->processes.push_back(proc);
+      data->emProcesses.push_back(em);
+      data->elossProcesses.push_back(eloss);
+      data->hadProcesses.push_back(had);
+    }
+    else
+    {
+      data->ignored.push_back(proc);
+    }
+  }
+  if(!data->ignored.empty())
+  {
+    G4ExceptionDescription ed;
+    ed << "No cross section is available for the processes";
+    for(size_t i=0; i<data->ignored.size(); ++i)
+    {
+      ed << " " << data->ignored[i]->GetProcessName();
+    }
+    ed << " of " << part->GetParticleName() << ", which are ignored"
+       << " in region " << fEnvelope->GetName() << ".";
+    G4Exception("G4WoodcockTrackingModel::GetParticleData()", "FastSim014",
+                JustWarning, ed);
+  }
+  if(fSigma.size() < data->processes.size())
+  {
+    fSigma.resize(data->processes.size(), 0.0);
+  }
+  fParticleData.push_back(data);
+  return data;
+}
+
+void G4WoodcockTrackingModel::SetProbe(const G4Track& track)
+{
+  const G4ParticleDefinition* part = track.GetParticleDefinition();
+  if(!fProbeTrack || fProbeTrack->GetParticleDefinition() != part)
+  {
+    delete fProbeTrack;
+    fProbeTrack = new G4Track(new G4DynamicParticle(part,
+                                                    track.GetMomentumDirection(),
+                                                    track.GetKineticEnergy()),
+                              track.GetGlobalTime(), track.GetPosition());
+    if(!fProbeStep) { fProbeStep = new G4Step(); }
+    fProbeTrack->SetStep(fProbeStep);
+    fProbeStep->SetTrack(fProbeTrack);
+  }
+  fProbeTrack->SetKineticEnergy(track.GetKineticEnergy());
+  fProbeTrack->SetMomentumDirection(track.GetMomentumDirection());
+  fProbeTrack->SetPolarization(track.GetPolarization());
+  fProbeTrack->SetPosition(track.GetPosition());
+  fProbeTrack->SetGlobalTime(track.GetGlobalTime());
+  fProbeTrack->SetTrackID(track.GetTrackID());
+  fProbeTrack->SetParentID(track.GetParentID());
+  fProbeTrack->SetWeight(track.GetWeight());
+}
+
+const G4MaterialCutsCouple*
+G4WoodcockTrackingModel::LocateCouple(const G4ThreeVector& position,
+                                      const G4ThreeVector& direction)
+{
+  G4VPhysicalVolume* world = G4TransportationManager::
+    GetTransportationManager()->GetNavigatorForTracking()->GetWorldVolume();
+  if(!fNavigator) { fNavigator = new G4Navigator(); }
+  if(fNavigator->GetWorldVolume() != world)
+  {
+    fNavigator->SetWorldVolume(world);
+    fNavigatorLocated = false;
+  }
+  G4VPhysicalVolume* pv =
+    fNavigator->LocateGlobalPointAndSetup(position, &direction,
+                                          fNavigatorLocated, false);
+  fNavigatorLocated = true;
+  if(!pv) { return 0; }
+
+  G4LogicalVolume* lv = pv->GetLogicalVolume();
+  const G4MaterialCutsCouple* couple = lv->GetMaterialCutsCouple();
+  G4Material* mat = lv->GetMaterial();
+  if(couple && couple->GetMaterial() != mat)
+  {
+    // for parameterised volumes
+    couple = G4ProductionCutsTable::GetProductionCutsTable()
+      ->GetMaterialCutsCouple(mat, couple->GetProductionCuts());
+  }
+  return couple;
+}
+
+G4double
+G4WoodcockTrackingModel::ComputeCrossSections(G4WoodcockParticleData* data,
+                                        const G4MaterialCutsCouple* couple)
+{
+  // Only the cross section tables are read: the numbers of interaction
+  // lengths left and the step limits of the processes are untouched
+  G4int idx = GetCoupleIndex(couple);
+  G4double ekin = fProbeTrack->GetKineticEnergy();
+  G4bool inGrid = (ekin >= fMinEnergy && ekin < fMaxEnergy &&
+                   !data->tables.empty());
+  size_t ncouples = fCouples.size();
+  G4double sum = 0.0;
+  size_t nproc = data->processes.size();
+  for(size_t i=0; i<nproc; ++i)
+  {
+    G4double sigma = (inGrid && !data->bounded[i])
+      ? data->tables[i*ncouples + idx]->Value(ekin)
+      : ComputeCrossSection(data, i, couple);
+    fSigma[i] = sigma;
+    sum += sigma;
+  }
+  return sum;
+}
+
+G4double
+G4WoodcockTrackingModel::ComputeCrossSection(G4WoodcockParticleData* data,
+                                             size_t i,
+                                        const G4MaterialCutsCouple* couple)
+{
+  const G4DynamicParticle* dp = fProbeTrack->GetDynamicParticle();
+  G4double ekin = dp->GetKineticEnergy();
+  G4double sigma = 0.0;
+  if(data->emProcesses[i])
+  {
+    sigma = data->emProcesses[i]->GetLambda(ekin, couple);
+  }
+  else if(data->elossProcesses[i])
+  {
+    sigma = data->elossProcesses[i]->GetLambda(ekin, couple);
+  }
+  else
+  {
+    sigma = data->hadProcesses[i]->GetCrossSectionDataStore()
+      ->GetCrossSection(dp, couple->GetMaterial());
+  }
+  return std::max(sigma, 0.0);
+}
+
+G4int
+G4WoodcockTrackingModel::GetCoupleIndex(const G4MaterialCutsCouple* cp) const
+{
+  size_t i = cp->GetIndex();
+  G4int idx = (i < fCoupleIndex.size()) ? fCoupleIndex[i] : -1;
+  if(idx < 0)
+  {
+    G4ExceptionDescription ed;
+    ed << "Material " << cp->GetMaterial()->GetName()
+       << " is met inside the envelope of region " << fEnvelope->GetName()
+       << " but does not belong to this region:" << G4endl
+       << "all the daughters of the envelope must belong to the region.";
+    G4Exception("G4WoodcockTrackingModel::GetCoupleIndex()", "FastSim015",
+                FatalException, ed);
+  }
+  return idx;
+}
+
+void
+G4WoodcockTrackingModel::ResetInteractionLengths(G4WoodcockParticleData* data)
+{
+  for(size_t i=0; i<data->processes.size(); ++i)
+  {
+    data->processes[i]->ResetNumberOfInteractionLengthLeft();
+  }
+  for(size_t i=0; i<data->ignored.size(); ++i)
+  {
+    data->ignored[i]->ResetNumberOfInteractionLengthLeft();
+  }
+}
+
+
+void G4WoodcockTrackingModel::BuildMajorant(G4WoodcockParticleData* data)
+{
+  if(fCouples.empty())
+  {
+    G4ProductionCutsTable* table =
+      G4ProductionCutsTable::GetProductionCutsTable();
+    std::vector<G4Material*>::const_iterator mBegin =
+      fEnvelope->GetMaterialIterator();
+    std::vector<G4Material*>::const_iterator mEnd =
+      mBegin + fEnvelope->GetNumberOfMaterials();
+    fCoupleIndex.assign(table->GetTableSize(), -1);
+    for(size_t i=0; i<table->GetTableSize(); ++i)
+    {
+      const G4MaterialCutsCouple* couple = table->GetMaterialCutsCouple(i);
+      if(couple->IsUsed() &&
+         std::find(mBegin, mEnd, couple->GetMaterial()) != mEnd)
+      {
+        fCoupleIndex[couple->GetIndex()] = fCouples.size();
+        fCouples.push_back(couple);
+      }
+    }
+  }
+  BuildTables(data);
+
+  // Piecewise constant majorant: in each bin, maximum over the couples
+  // of the sum of the upper bounds of the cross sections in the bin.
+  // The interpolants of the lambda tables are bounded exactly, and the
+  // maxima of the linearly interpolated tables of the model are at the
+  // grid nodes of the bin.
+  size_t nproc = data->processes.size();
+  size_t ncouples = fCouples.size();
+  data->majorant.assign(fNBins, 0.0);
+  G4double binWidth = 1.0/fInvLogBinWidth;
+  for(G4int i=0; i<fNBins; ++i)
+  {
+    G4double e1 = fMinEnergy*G4Exp(i*binWidth);
+    G4double e2 = fMinEnergy*G4Exp((i + 1)*binWidth);
+    G4double sigmaMax = 0.0;
+    for(size_t j=0; j<ncouples; ++j)
+    {
+      G4double sigma = 0.0;
+      for(size_t k=0; k<nproc; ++k)
+      {
+        if(data->bounded[k])
+        {
+          sigma += data->emProcesses[k]->GetMaxLambda(e1, e2, fCouples[j]);
+          continue;
+        }
+        const G4PhysicsVector* pv = data->tables[k*ncouples + j];
+        G4double x = 0.0;
+        for(G4int n=i*nSubBins; n<=(i + 1)*nSubBins; ++n)
+        {
+          x = std::max(x, (*pv)[n]);
+        }
+        sigma += x;
+      }
+      sigmaMax = std::max(sigmaMax, sigma);
+    }
+    data->majorant[i] = (1.0 + roundingMargin)*sigmaMax;
+  }
+
+#ifdef G4VERBOSE
+  if(fVerboseLevel > 0)
+  {
+    G4int nbounded = G4int(std::count(data->bounded.begin(),
+                                      data->bounded.end(), true));
+    G4cout << "G4WoodcockTrackingModel: majorant of "
+           << data->particle->GetParticleName() << " built for region "
+           << fEnvelope->GetName() << " with " << ncouples
+           << " couples and " << nproc << " processes, "
+           << nproc - nbounded << " of them tabulated" << G4endl;
+  }
+#endif
+}
+
+void G4WoodcockTrackingModel::BuildTables(G4WoodcockParticleData* data)
+{
+  // A process is bounded from its own tables if they cover the energy
+  // grid for all couples of the region
+  size_t nproc = data->processes.size();
+  size_t ncouples = fCouples.size();
+  data->bounded.assign(nproc, false);
+  G4bool tabulated = false;
+  for(size_t k=0; k<nproc; ++k)
+  {
+    G4VEmProcess* em = data->emProcesses[k];
+    G4bool bounded = (em != 0);
+    for(size_t j=0; j<ncouples && bounded; ++j)
+    {
+      bounded = (em->GetMaxLambda(fMinEnergy, fMaxEnergy, fCouples[j]) >= 0.0);
+    }
+    data->bounded[k] = bounded;
+    if(!bounded) { tabulated = true; }
+  }
+  if(!tabulated) { return; }
+
+  // The other cross sections are tabulated for each couple on a grid
+  // aligned with the majorant bins
+  G4double ekin0 = fProbeTrack->GetKineticEnergy();
+  data->tables.assign(nproc*ncouples, static_cast<G4PhysicsVector*>(0));
+  for(size_t k=0; k<nproc; ++k)
+  {
+    if(data->bounded[k]) { continue; }
+    for(size_t j=0; j<ncouples; ++j)
+    {
+      G4PhysicsVector* pv =
+        new G4PhysicsLogVector(fMinEnergy, fMaxEnergy, fNBins*nSubBins);
+      size_t nnodes = pv->GetVectorLength();
+      for(size_t n=0; n<nnodes; ++n)
+      {
+        fProbeTrack->SetKineticEnergy(pv->Energy(n));
+        pv->PutValue(n, ComputeCrossSection(data, k, fCouples[j]));
+      }
+      data->tables[k*ncouples + j] = pv;
+    }
+  }
+  fProbeTrack->SetKineticEnergy(ekin0);
+}
+
+G4double G4WoodcockTrackingModel::GetMajorant(G4WoodcockParticleData* data,
+                                              G4double ekin)
+{
+  if(data->majorant.empty()) { BuildMajorant(data); }
+  if(ekin < fMinEnergy || ekin >= fMaxEnergy)
+  {
+    // the cross sections are computed by the processes at this energy,
+    // which does not change during the flight
+    G4double sigmaMax = 0.0;
+    for(size_t i=0; i<fCouples.size(); ++i)
+    {
+      sigmaMax = std::max(sigmaMax, ComputeCrossSections(data, fCouples[i]));
+    }
+    return sigmaMax;
+  }
+  G4int i = G4int(G4Log(ekin/fMinEnergy)*fInvLogBinWidth);
+  return data->majorant[std::min(i, fNBins - 1)];
+}
@@ -127,6 +127,11 @@ class G4Transportation : public G4VProcess
      static G4bool EnableUseMagneticMoment(G4bool useMoment=true); 
      // Whether to deflect particles with force due to magnetic moment
 
+     static G4bool EnableShortStepOptimisationForNeutrals(G4bool optimise=true);
+     // Whether steps of neutral particles within the cached isotropic
+     // safety avoid calling the Navigator (if no force is exerted),
+     // independently of EnableShortStepOptimisation. Returns last value.
+
   public:  // without description
 
      G4double AtRestGetPhysicalInteractionLength(
@@ -218,6 +223,7 @@ class G4Transportation : public G4VProcess
   private:
      friend class G4CoupledTransportation;
      static G4bool fUseMagneticMoment; 
+     static G4bool fShortStepOptimisationForNeutrals;
 
 };
 
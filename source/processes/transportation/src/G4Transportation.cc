@@ -73,6 +73,7 @@
 class G4VSensitiveDetector;
 
 G4bool G4Transportation::fUseMagneticMoment=false;
+G4bool G4Transportation::fShortStepOptimisationForNeutrals=false;
 
 // #define  G4DEBUG_TRANSPORT 1
 
@@ -265,7 +266,12 @@ AlongStepGetPhysicalInteractionLength( const G4Track&  track,
   if( !fieldExertsForce ) 
   {
      G4double linearStepLength ;
-     if( fShortStepOptimisation && (currentMinimumStep <= currentSafety) )
+     // Neutral particles move on a straight line and their physics does
+     // not use the safety: the cached isotropic safety can be trusted.
+     // Relocation is then only within the volume (see PostStepDoIt).
+     G4bool shortStepOptimisation = fShortStepOptimisation
+       || (fShortStepOptimisationForNeutrals && particleCharge == 0.0);
+     if( shortStepOptimisation && (currentMinimumStep <= currentSafety) )
      {
        // The Step is guaranteed to be taken
        //
@@ -825,3 +831,12 @@ G4bool G4Transportation::EnableUseMagneticMoment(G4bool useMoment)
   G4CoupledTransportation::fUseMagneticMoment= useMoment;
   return lastValue;
 }
+
+//////////////////////////////////////////////////////////////////////////
+
+G4bool G4Transportation::EnableShortStepOptimisationForNeutrals(G4bool optimise)
+{
+  G4bool lastValue= fShortStepOptimisationForNeutrals;
+  fShortStepOptimisationForNeutrals= optimise;
+  return lastValue;
+}
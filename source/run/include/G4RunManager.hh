@@ -263,6 +263,9 @@ public: // with description
     void CleanUpPreviousEvents();
     void CleanUpUnnecessaryEvents(G4int keepNEvents);
     void StackPreviousEvent(G4Event* anEvent);
+    G4Event* CreateEvent(G4int i_event);
+    //  Returns a new G4Event object, or the recycled one in the event recycling
+    // mode. To be used by GenerateEvent().
 
   public:
     enum RMType { sequentialRM, masterRM, workerRM };
@@ -307,6 +310,8 @@ public: // with description
     std::list<G4Event*>* previousEvents;
     G4int n_perviousEventsToBeStored;
     G4int numberOfEventToBeProcessed;
+    G4bool recycleEvents;
+    G4Event* recycledEvent;
 
     G4bool storeRandomNumberStatus;
     G4int storeRandomNumberStatusToG4Event;
@@ -523,6 +528,15 @@ public: // with description
     // events can be used with the most recent event for digitizing pileup. "val"+1
     // previous event is deleted.
     //  This method must be invoked before starting the event loop.
+    inline void SetEventRecycling(G4bool val)
+    { recycleEvents = val; }
+    inline G4bool GetEventRecycling() const
+    { return recycleEvents; }
+    //  In the event recycling mode, an event which is neither kept, nor stored as
+    // previous event, nor gripped for post-processing, is not deleted but reused by
+    // the next event, together with its G4HCofThisEvent object, hits collections
+    // and trajectory container (see G4Event::ResetForReuse() and
+    // G4VSensitiveDetector::GetRecycledCollection()).
     inline const G4Run* GetCurrentRun() const
     { return currentRun; }
     inline G4Run* GetNonConstCurrentRun() const
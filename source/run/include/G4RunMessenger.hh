@@ -95,6 +95,7 @@ class G4RunMessenger: public G4UImessenger
     G4UIcmdWithABool *          brkBoECmd;
     G4UIcmdWithABool *          brkEoECmd;
     G4UIcmdWithABool *          abortCmd;
+    G4UIcmdWithABool *          recycleCmd;
     G4UIcmdWithoutParameter *   abortEventCmd;
     G4UIcmdWithoutParameter *   initCmd;
     G4UIcmdWithoutParameter *   geomCmd;
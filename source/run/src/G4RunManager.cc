@@ -59,6 +59,7 @@
 #include "G4UImanager.hh"
 #include "G4ProductionCutsTable.hh"
 #include "G4ParallelWorldProcessStore.hh"
+#include "G4SteppingVerbose.hh"
 #include "G4ios.hh"
 #include <sstream>
 
@@ -90,7 +91,7 @@ G4RunManager::G4RunManager()
  geometryToBeOptimized(true),runIDCounter(0),
  verboseLevel(0),printModulo(-1),DCtable(0),
  currentRun(0),currentEvent(0),n_perviousEventsToBeStored(0),
- numberOfEventToBeProcessed(0),storeRandomNumberStatus(false),
+ numberOfEventToBeProcessed(0),recycleEvents(false),recycledEvent(0),storeRandomNumberStatus(false),
  storeRandomNumberStatusToG4Event(0),rngStatusEventsFlag(false),
  currentWorld(0),nParallelWorlds(0),msgText(" "),n_select_msg(-1),
  numberOfEventProcessed(0),selectMacro(""),fakeRun(false)
@@ -129,7 +130,7 @@ G4RunManager::G4RunManager( RMType rmType )
  geometryToBeOptimized(true),runIDCounter(0),
  verboseLevel(0),printModulo(-1),DCtable(0),
  currentRun(0),currentEvent(0),n_perviousEventsToBeStored(0),
- numberOfEventToBeProcessed(0),storeRandomNumberStatus(false),
+ numberOfEventToBeProcessed(0),recycleEvents(false),recycledEvent(0),storeRandomNumberStatus(false),
  storeRandomNumberStatusToG4Event(0),rngStatusEventsFlag(false),
  currentWorld(0),nParallelWorlds(0),msgText(" "),n_select_msg(-1),
  numberOfEventProcessed(0),selectMacro(""),fakeRun(false)
@@ -435,7 +436,7 @@ G4Event* G4RunManager::GenerateEvent(G4int i_event)
     return 0;
   }
 
-  G4Event* anEvent = new G4Event(i_event);
+  G4Event* anEvent = CreateEvent(i_event);
 
   if(storeRandomNumberStatusToG4Event==1 || storeRandomNumberStatusToG4Event==3)
   {
@@ -483,6 +484,15 @@ void G4RunManager::RunTermination()
     G4VPersistencyManager* fPersM = G4VPersistencyManager::GetPersistencyManager();
     if(fPersM) fPersM->Store(currentRun);
     runIDCounter++;
+
+    // Step profile of this thread; a worker merges its counters before
+    // the master (or sequential) run manager writes the whole profile.
+    G4SteppingVerbose::MergeProfile();
+    if(runManagerType!=workerRM)
+    {
+      G4SteppingVerbose::WriteProfile();
+      G4SteppingVerbose::ResetProfile();
+    }
   }
 
   kernel->RunTermination();
@@ -505,6 +515,9 @@ void G4RunManager::CleanUpPreviousEvents()
     if(evt && !(evt->ToBeKept())) delete evt;
     evItr = previousEvents->erase(evItr); 
   }
+
+  delete recycledEvent;
+  recycledEvent = 0;
 }
 
 void G4RunManager::CleanUpUnnecessaryEvents(G4int keepNEvents)
@@ -543,7 +556,18 @@ void G4RunManager::StackPreviousEvent(G4Event* anEvent)
   if(n_perviousEventsToBeStored==0)
   {
     if(anEvent->GetNumberOfGrips()==0) 
-    { if(!(anEvent->ToBeKept())) delete anEvent; }
+    {
+      if(!(anEvent->ToBeKept()))
+      {
+        if(recycleEvents)
+        {
+          delete recycledEvent;
+          recycledEvent = anEvent;
+        }
+        else
+        { delete anEvent; }
+      }
+    }
     else
     { previousEvents->push_back(anEvent); }
   }
@@ -551,6 +575,18 @@ void G4RunManager::StackPreviousEvent(G4Event* anEvent)
   CleanUpUnnecessaryEvents(n_perviousEventsToBeStored);
 }
 
+G4Event* G4RunManager::CreateEvent(G4int i_event)
+{
+  if(recycledEvent)
+  {
+    G4Event* anEvent = recycledEvent;
+    recycledEvent = 0;
+    anEvent->ResetForReuse(i_event);
+    return anEvent;
+  }
+  return new G4Event(i_event);
+}
+
 void G4RunManager::Initialize()
 {
   G4StateManager* stateManager = G4StateManager::GetStateManager();
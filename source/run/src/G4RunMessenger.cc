@@ -211,6 +211,15 @@ G4RunMessenger::G4RunMessenger(G4RunManager * runMgr)
   abortCmd->SetParameterName("softAbort",true);
   abortCmd->SetDefaultValue(false);
 
+  recycleCmd = new G4UIcmdWithABool("/run/recycleEvents",this);
+  recycleCmd->SetGuidance("Reuse G4Event, G4HCofThisEvent and hits collections between events.");
+  recycleCmd->SetGuidance("An event which is not kept is cleared and reused by the next event,");
+  recycleCmd->SetGuidance("and its hits collections are emptied with their capacity retained.");
+  recycleCmd->SetGuidance("Sensitive detectors opt in through G4VSensitiveDetector::GetRecycledCollection().");
+  recycleCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+  recycleCmd->SetParameterName("flag",true);
+  recycleCmd->SetDefaultValue(true);
+
   abortEventCmd = new G4UIcmdWithoutParameter("/run/abortCurrentEvent",this);
   abortEventCmd->SetGuidance("Abort currently processing event.");
   abortEventCmd->AvailableForStates(G4State_EventProc);
@@ -348,6 +357,7 @@ G4RunMessenger::~G4RunMessenger()
   delete brkBoECmd;
   delete brkEoECmd;
   delete abortCmd;
+  delete recycleCmd;
   delete abortEventCmd;
   delete initCmd;
   delete geomCmd;
@@ -490,6 +500,8 @@ void G4RunMessenger::SetNewValue(G4UIcommand * command,G4String newValue)
   { G4UImanager::GetUIpointer()->SetPauseAtEndOfEvent(brkEoECmd->GetNewBoolValue(newValue)); }
   else if( command==abortCmd )
   { runManager->AbortRun(abortCmd->GetNewBoolValue(newValue)); }
+  else if( command==recycleCmd )
+  { runManager->SetEventRecycling(recycleCmd->GetNewBoolValue(newValue)); }
   else if( command==abortEventCmd )
   { runManager->AbortEvent(); }
   else if( command==initCmd )
@@ -566,6 +578,8 @@ G4String G4RunMessenger::GetCurrentValue(G4UIcommand * command)
   { cv = runManager->GetRandomNumberStoreDir(); }
   else if( command==randEvtCmd )
   { cv = randEvtCmd->ConvertToString(runManager->GetFlagRandomNumberStatusToG4Event()); }
+  else if( command==recycleCmd )
+  { cv = recycleCmd->ConvertToString(runManager->GetEventRecycling()); }
   else if( command==nThreadsCmd )
   {
     G4RunManager::RMType rmType = runManager->GetRunManagerType();
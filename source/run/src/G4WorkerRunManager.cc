@@ -259,7 +259,7 @@ void G4WorkerRunManager::ProcessOneEvent(G4int i_event)
 
 G4Event* G4WorkerRunManager::GenerateEvent(G4int i_event)
 {
-  G4Event* anEvent = new G4Event(i_event);
+  G4Event* anEvent = CreateEvent(i_event);
   long s1 = 0;
   long s2 = 0;
   long s3 = 0;
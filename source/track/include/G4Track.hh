@@ -45,6 +45,8 @@
 //   Add SetVelocityTableProperties                 02 Apr. 2011  H.Kurashige
 //   Add fVelocity and Set/GetVelocity              29 Apr. 2011  H.Kurashige
 //   Use G4VelocityTable                     17 AUg. 2011 H.Kurashige
+//   Add allocation counters                 19 Oct. 2026
+//   Group integer and boolean members to remove padding  19 Oct. 2026
 
 #ifndef G4Track_h
 #define G4Track_h 1
@@ -105,6 +107,11 @@ public: // With description
    inline void operator delete(void *aTrack);
       // Override "delete" for "G4Allocator".
 
+   static G4long GetNumberOfAllocatedTracks();
+   static G4long GetNumberOfDeletedTracks();
+      // Number of G4Track objects allocated and deleted by the
+      // current thread since the start of the job.
+
    G4bool operator==( const G4Track& );
   
 //--------
@@ -270,21 +277,25 @@ public: // With description
    private:
 //---------
    // Member data
-   G4int fCurrentStepNumber;       // Total steps number up to now
    G4ThreeVector fPosition;        // Current positon
    G4double fGlobalTime;           // Time since the event is created
    G4double fLocalTime;            // Time since the track is created
    G4double fTrackLength;          // Accumulated track length
-   G4int    fParentID;
-   G4int    fTrackID;
    G4double fVelocity; 
 
-   G4TouchableHandle fpTouchable;
-   G4TouchableHandle fpNextTouchable;
-   G4TouchableHandle fpOriginTouchable;
-  // Touchable Handle
+   G4double fStepLength;           
+      // Before the end of the AlongStepDoIt loop, this keeps the initial 
+      // Step length which is determined by the shortest geometrical Step 
+      // proposed by a physics process. After finishing the AlongStepDoIt,
+      // this will be set equal to 'StepLength' in G4Step.
 
-   G4DynamicParticle* fpDynamicParticle;
+   G4double fWeight;
+     // This is a weight for this track 
+
+   G4int    fCurrentStepNumber;    // Total steps number up to now
+   G4int    fParentID;
+   G4int    fTrackID;
+   G4int    fCreatorModelIndex;    // Index of the physics model which created the track
    G4TrackStatus fTrackStatus;
 
    G4bool  fBelowThreshold;
@@ -293,15 +304,18 @@ public: // With description
    G4bool  fGoodForTracking;
    // This flag is set by processes if this track should be tracked
    // even if the energy is below threshold
+   G4bool          is_OpticalPhoton; 
+   G4bool          useGivenVelocity;
+      // do not calclulate velocity and just use current fVelocity
+      // if this flag is set
+   // Integer and boolean members are grouped to avoid padding
 
-   G4double fStepLength;           
-      // Before the end of the AlongStepDoIt loop, this keeps the initial 
-      // Step length which is determined by the shortest geometrical Step 
-      // proposed by a physics process. After finishing the AlongStepDoIt,
-      // this will be set equal to 'StepLength' in G4Step.
+   G4TouchableHandle fpTouchable;
+   G4TouchableHandle fpNextTouchable;
+   G4TouchableHandle fpOriginTouchable;
+  // Touchable Handle
 
-   G4double fWeight;
-     // This is a weight for this track 
+   G4DynamicParticle* fpDynamicParticle;
 
    const G4Step* fpStep;
 
@@ -310,7 +324,6 @@ public: // With description
    G4double fVtxKineticEnergy;          // Kinetic energy at the vertex
    const G4LogicalVolume* fpLVAtVertex; //Logical Volume at the vertex
    const G4VProcess* fpCreatorProcess; // Process which created the track
-   G4int fCreatorModelIndex;           // Index of the physics model which created the track
    
    mutable G4VUserTrackInformation* fpUserInformation;
 
@@ -320,13 +333,8 @@ public: // With description
    mutable G4double                  prev_velocity;
    mutable G4double                  prev_momentum;
 
-   G4bool          is_OpticalPhoton; 
    static G4ThreadLocal G4VelocityTable*  velTable;
  
-   G4bool          useGivenVelocity;
-      // do not calclulate velocity and just use current fVelocity
-      // if this flag is set
-
    mutable std::map<G4int,G4VAuxiliaryTrackInformation*>* fpAuxiliaryTrackInformationMap;
 
 //--------
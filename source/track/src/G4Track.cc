@@ -50,6 +50,8 @@
 #include <iomanip>
 
 G4ThreadLocal G4Allocator<G4Track> *aTrackAllocator = 0;
+G4ThreadLocal G4long aTrackAllocCounter = 0;
+G4ThreadLocal G4long aTrackFreeCounter = 0;
 
 G4ThreadLocal G4VelocityTable*  G4Track::velTable=0;
 
@@ -58,24 +60,25 @@ G4Track::G4Track(G4DynamicParticle* apValueDynamicParticle,
                  G4double aValueTime,
                  const G4ThreeVector& aValuePosition)
 ///////////////////////////////////////////////////////////
-  : fCurrentStepNumber(0),    fPosition(aValuePosition),
+  : fPosition(aValuePosition),
     fGlobalTime(aValueTime),  fLocalTime(0.),
     fTrackLength(0.),
-    fParentID(0),             fTrackID(0),
     fVelocity(c_light),
-    fpDynamicParticle(apValueDynamicParticle),
+    fStepLength(0.0),         fWeight(1.0),
+    fCurrentStepNumber(0),
+    fParentID(0),             fTrackID(0),
+    fCreatorModelIndex(-1),
     fTrackStatus(fAlive),
     fBelowThreshold(false),   fGoodForTracking(false),
-    fStepLength(0.0),         fWeight(1.0),
+    is_OpticalPhoton(false),
+    useGivenVelocity(false),
+    fpDynamicParticle(apValueDynamicParticle),
     fpStep(0),
     fVtxKineticEnergy(0.0),
     fpLVAtVertex(0),          fpCreatorProcess(0),
-    fCreatorModelIndex(-1),
     fpUserInformation(0),
     prev_mat(0),  groupvel(0),
     prev_velocity(0.0), prev_momentum(0.0),
-    is_OpticalPhoton(false),
-    useGivenVelocity(false),
     fpAuxiliaryTrackInformationMap(0)
 {
   static G4ThreadLocal G4bool isFirstTime = true;
@@ -97,24 +100,24 @@ G4Track::G4Track(G4DynamicParticle* apValueDynamicParticle,
 //////////////////
 G4Track::G4Track()
 //////////////////
-  : fCurrentStepNumber(0),    
-    fGlobalTime(0),           fLocalTime(0.),
+  : fGlobalTime(0),  fLocalTime(0.),
     fTrackLength(0.),
-    fParentID(0),             fTrackID(0),
     fVelocity(c_light),
-    fpDynamicParticle(0),
+    fStepLength(0.0),         fWeight(1.0),
+    fCurrentStepNumber(0),
+    fParentID(0),             fTrackID(0),
+    fCreatorModelIndex(-1),
     fTrackStatus(fAlive),
     fBelowThreshold(false),   fGoodForTracking(false),
-    fStepLength(0.0),         fWeight(1.0),
+    is_OpticalPhoton(false),
+    useGivenVelocity(false),
+    fpDynamicParticle(0),
     fpStep(0),
     fVtxKineticEnergy(0.0),
     fpLVAtVertex(0),          fpCreatorProcess(0),
-    fCreatorModelIndex(-1),
     fpUserInformation(0),
     prev_mat(0),  groupvel(0),
     prev_velocity(0.0), prev_momentum(0.0),
-    is_OpticalPhoton(false),
-    useGivenVelocity(false),
     fpAuxiliaryTrackInformationMap(0)
 {
 }
@@ -122,24 +125,24 @@ G4Track::G4Track()
 //////////////////
 G4Track::G4Track(const G4Track& right)
 //////////////////
-  : fCurrentStepNumber(0),    
-    fGlobalTime(0),           fLocalTime(0.),
+  : fGlobalTime(0),  fLocalTime(0.),
     fTrackLength(0.),
-    fParentID(0),             fTrackID(0),
     fVelocity(c_light),
-    fpDynamicParticle(0),
+    fStepLength(0.0),         fWeight(1.0),
+    fCurrentStepNumber(0),
+    fParentID(0),             fTrackID(0),
+    fCreatorModelIndex(-1),
     fTrackStatus(fAlive),
     fBelowThreshold(false),   fGoodForTracking(false),
-    fStepLength(0.0),         fWeight(1.0),
+    is_OpticalPhoton(false),
+    useGivenVelocity(false),
+    fpDynamicParticle(0),
     fpStep(0),
     fVtxKineticEnergy(0.0),
     fpLVAtVertex(0),          fpCreatorProcess(0),
-    fCreatorModelIndex(-1),
     fpUserInformation(0),
     prev_mat(0),  groupvel(0),
     prev_velocity(0.0), prev_momentum(0.0),
-    is_OpticalPhoton(false),
-    useGivenVelocity(false),
     fpAuxiliaryTrackInformationMap(0)
 {
   *this = right;
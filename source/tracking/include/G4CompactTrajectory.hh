@@ -0,0 +1,157 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+//---------------------------------------------------------------
+//
+// G4CompactTrajectory.hh
+//
+// class description:
+//   Trajectory of a tracked particle keeping its points by value in
+//   contiguous arrays: positions (as G4TrajectoryPoint objects) and
+//   global times, instead of one allocated point per step. With a
+//   non-zero decimation length, a point is kept if it is at least this
+//   length away from the last kept point, or if the track reverses its
+//   direction there. The last point is always stored, so that the track
+//   ends stay exact; it is replaced by the next point if it is not kept.
+//   Selected with /tracking/storeTrajectory 5.
+//
+// 19.10.2026 First implementation
+// 19.10.2026 Decimation compares with the last kept point and keeps
+//            direction reversals
+// ---------------------------------------------------------------
+
+#ifndef G4CompactTrajectory_h
+#define G4CompactTrajectory_h 1
+
+#include <vector>
+
+#include "trkgdefs.hh"
+#include "G4VTrajectory.hh"
+#include "G4Allocator.hh"
+#include "G4ios.hh"
+#include "globals.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4TrajectoryPoint.hh"
+#include "G4Track.hh"
+#include "G4Step.hh"
+
+/////////////////////////
+class G4CompactTrajectory : public G4VTrajectory
+/////////////////////////
+{
+
+//--------
+public: // with description
+//--------
+
+// Constructor/Destrcutor
+
+   G4CompactTrajectory();
+   G4CompactTrajectory(const G4Track* aTrack);
+   G4CompactTrajectory(G4CompactTrajectory &);
+   virtual ~G4CompactTrajectory();
+
+// Operators
+   inline void* operator new(size_t);
+   inline void  operator delete(void*);
+   inline int operator == (const G4CompactTrajectory& right) const
+   {return (this==&right);} 
+
+// Get/Set functions 
+   inline G4int GetTrackID() const
+   { return fTrackID; }
+   inline G4int GetParentID() const
+   { return fParentID; }
+   inline G4String GetParticleName() const
+   { return ParticleName; }
+   inline G4double GetCharge() const
+   { return PDGCharge; }
+   inline G4int GetPDGEncoding() const
+   { return PDGEncoding; }
+   inline G4double GetInitialKineticEnergy() const
+   { return initialKineticEnergy; }
+   inline G4ThreeVector GetInitialMomentum() const
+   { return initialMomentum; }
+   inline G4double GetPointTime(G4int i) const
+   { return fTimes[i]; }
+      // Global time of the i-th point
+
+// Other member functions
+   virtual void ShowTrajectory(std::ostream& os=G4cout) const;
+   virtual void DrawTrajectory() const;
+   virtual void AppendStep(const G4Step* aStep);
+   virtual int GetPointEntries() const { return fPoints.size(); }
+   virtual G4VTrajectoryPoint* GetPoint(G4int i) const 
+   { return const_cast<G4TrajectoryPoint*>(&fPoints[i]); }
+      // The pointer is valid until the next AppendStep or MergeTrajectory
+   virtual void MergeTrajectory(G4VTrajectory* secondTrajectory);
+
+   G4ParticleDefinition* GetParticleDefinition();
+
+   virtual const std::map<G4String,G4AttDef>* GetAttDefs() const;
+   virtual std::vector<G4AttValue>* CreateAttValues() const;
+
+   static void SetDecimationLength(G4double value);
+   static G4double GetDecimationLength();
+      // Minimum distance between kept points (default 0: every step)
+
+//---------
+   private:
+//---------
+
+  std::vector<G4TrajectoryPoint> fPoints;
+  std::vector<G4double>          fTimes;
+  G4int                     fTrackID;
+  G4int                     fParentID;
+  G4int                     PDGEncoding;
+  G4double                  PDGCharge;
+  G4String                  ParticleName;
+  G4double                  initialKineticEnergy;
+  G4ThreeVector             initialMomentum;
+  G4bool                    fLastPointTentative;
+      // True if the last point is stored only as the current end of the
+      // track, and is replaced by the next point unless it is kept
+
+  static G4ThreadLocal G4double fDecimationLength;
+
+};
+
+extern G4TRACKING_DLL G4ThreadLocal
+G4Allocator<G4CompactTrajectory> *aCompactTrajectoryAllocator;
+
+inline void* G4CompactTrajectory::operator new(size_t)
+{
+  if (!aCompactTrajectoryAllocator)
+  { aCompactTrajectoryAllocator = new G4Allocator<G4CompactTrajectory>; }
+  return (void*)aCompactTrajectoryAllocator->MallocSingle();
+}
+
+inline void G4CompactTrajectory::operator delete(void* aTrajectory)
+{
+  aCompactTrajectoryAllocator->FreeSingle((G4CompactTrajectory*)aTrajectory);
+}
+
+#endif
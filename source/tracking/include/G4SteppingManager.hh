@@ -46,6 +46,8 @@
 //
 //---------------------------------------------------------------
 //   modified for new ParticleChange 12 Mar. 1998  H.Kurashige
+//   19.10.2026 added flat lists of active processes per track
+//   19.10.2026 added fused step limit of discrete EM processes
 
 
 class G4SteppingManager;
@@ -54,6 +56,8 @@ class G4SteppingManager;
 #define G4SteppingManager_h 1
 
 class G4VSensitiveDetector;
+class G4VEmProcess;
+class G4MaterialCutsCouple;
 
 #include "G4ios.hh"                   // Include from 'system'
 #include <iomanip>              // Include from 'system'
@@ -119,6 +123,21 @@ public: //without description
    G4Step* GetStep() const;
    void SetNavigator(G4Navigator* value);
 
+   void SetFlatProcessList(G4bool value);
+   G4bool GetFlatProcessList() const;
+   void AddFlatProcessListParticle(G4int pdgCode);
+      // When enabled, GetProcessNumber() collects the processes active
+      // for the current track into flat lists, and the GPIL/DoIt loops
+      // of the stepping iterate only over those. By default this applies
+      // to e-, e+ and gamma; other particles use the full vectors.
+      // Process (in)activation takes effect at the next track.
+      // For these particles the discrete EM processes which allow it
+      // (G4VEmProcess::AllowFusedStepLimit()) share one step limit,
+      // sampled from the sum of their cross sections; the process which
+      // interacts is selected in proportion to its cross section in the
+      // PostStepDoIt. Until then the first of them is the process
+      // defining the step.
+
 
 // Other member functions
 
@@ -198,6 +217,9 @@ public: //without description
    void InvokeAlongStepDoItProcs();
    void InvokePostStepDoItProcs();
    void InvokePSDIP(size_t); // 
+   void BuildFlatProcessList();
+   G4double FusedPostStepGPIL();
+   G4VProcess* SelectFusedProcess();
    G4double CalculateSafety();
       // Return the estimated safety value at the PostStepPoint
    void ApplyProductionCut(G4Track*);
@@ -287,6 +309,27 @@ public: //without description
       // the method Verbose, they are kept at here. Need a more 
       // elegant mechanism.
 
+   G4bool fFlatProcessList;
+   std::vector<G4int> fFlatProcessListPDG;
+      // Switch and PDG codes of the particles using flat process lists
+   G4bool fUseFlatProcessList;
+      // True if the current track uses the flat lists below
+   std::vector<size_t> fActivePostStepGPIL;
+   std::vector<size_t> fActiveAlongStepGPIL;
+   std::vector<size_t> fActiveAlongStepDoIt;
+      // Indices of the non-NULL entries of the corresponding vectors
+   size_t fFusedPostStepIndex;
+      // PostStep GPIL index of the fused step limit, which stands for
+      // all fused processes (SizeOfSelectedDoItVector if none)
+   std::vector<G4VEmProcess*> fFusedProcesses;
+   std::vector<G4double> fFusedLambda;
+      // Fused processes and running sums of their cross sections
+   const G4MaterialCutsCouple* fFusedCouple;
+   G4double fFusedKinEnergy;
+      // Couple and energy of the cross sections above
+   G4double fFusedNumberOfInteractionLengthLeft;
+   G4double fFusedInteractionLength;
+
 };
 
 
@@ -464,6 +507,13 @@ public: //without description
     fNavigator = value; 
   }
 
+  inline void G4SteppingManager::SetFlatProcessList(G4bool value){
+    fFlatProcessList = value;
+  }
+  inline G4bool G4SteppingManager::GetFlatProcessList() const {
+    return fFlatProcessList;
+  }
+
   inline void G4SteppingManager::SetUserAction(G4UserSteppingAction* apAction){
     fUserSteppingAction = apAction;
   }
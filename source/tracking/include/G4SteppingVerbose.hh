@@ -32,6 +32,10 @@
 //
 // class dscription:
 //   This class manages the vervose outputs in G4SteppingManager. 
+//   It also holds the step profile (/tracking/profile), filled by
+//   G4SteppingManager: the steps, their navigation calls and a sample
+//   of their time, per particle, process defining the step, region and
+//   logical volume.
 //   
 //
 // Contact:
@@ -48,6 +52,8 @@ class G4SteppingVerbose;
 
 #include "G4VSteppingVerbose.hh"
 
+class G4Step;
+
 class G4SteppingVerbose : public G4VSteppingVerbose {
 public:   // with description
 // Constructor/Destructor
@@ -73,6 +79,35 @@ public:   // with description
   void ShowStep() const;
 //
 
+public:   // with description
+// Profiling mode
+  static void SetProfiling(G4int samplingPeriod);
+  static G4int GetProfiling();
+  //  0 switches the profiling off. Otherwise the steps of this thread are
+  // counted, and the time of one step out of samplingPeriod is measured.
+  // It does not depend on the verbose level nor on the stepping verbose
+  // class in use.
+  static void ProfileStepBegin(const G4Navigator* navigator);
+  static void ProfileStepEnd(const G4Step* aStep,
+                             const G4Navigator* navigator);
+  //  Invoked by G4SteppingManager at the beginning and at the end of each
+  // step while the profiling is on. The calls to ComputeStep() and Locate
+  // of the navigator in between are attributed to the step.
+  static void SetProfileFileName(const G4String& fileName);
+  static const G4String& GetProfileFileName();
+  //  Output of WriteProfile(): JSON if the name ends with ".json", CSV
+  // otherwise. With an empty name, the main entries are printed.
+  static void MergeProfile();
+  //  Adds the counters of this thread to the global (thread-safe) profile
+  // and clears them. Invoked by G4RunManager at the end of run of each thread.
+  static void WriteProfile();
+  static void ResetProfile();
+  //  Write and clear the global profile, invoked at the end of run by the
+  // master (or sequential) run manager.
+
+private:
+  static G4ThreadLocal G4int fProfileSampling;
+  static G4ThreadLocal G4String* fProfileFileName;
 };
 
 
@@ -0,0 +1,244 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// ---------------------------------------------------------------
+//
+// G4CompactTrajectory.cc
+//
+// 19.10.2026 First implementation
+// 19.10.2026 Decimation compares with the last kept point and keeps
+//            direction reversals
+// ---------------------------------------------------------------
+
+#include "G4CompactTrajectory.hh"
+#include "G4ParticleTable.hh"
+#include "G4AttDefStore.hh"
+#include "G4AttDef.hh"
+#include "G4AttValue.hh"
+#include "G4UIcommand.hh"
+#include "G4UnitsTable.hh"
+
+//#define G4ATTDEBUG
+#ifdef G4ATTDEBUG
+#include "G4AttCheck.hh"
+#endif
+
+G4ThreadLocal G4Allocator<G4CompactTrajectory> *aCompactTrajectoryAllocator = 0;
+
+G4ThreadLocal G4double G4CompactTrajectory::fDecimationLength = 0.;
+
+G4CompactTrajectory::G4CompactTrajectory()
+:  fTrackID(0), fParentID(0),
+   PDGEncoding( 0 ), PDGCharge(0.0), ParticleName(""),
+   initialKineticEnergy( 0. ), initialMomentum( G4ThreeVector() ),
+   fLastPointTentative(false)
+{;}
+
+G4CompactTrajectory::G4CompactTrajectory(const G4Track* aTrack)
+{
+   G4ParticleDefinition * fpParticleDefinition = aTrack->GetDefinition();
+   ParticleName = fpParticleDefinition->GetParticleName();
+   PDGCharge = fpParticleDefinition->GetPDGCharge();
+   PDGEncoding = fpParticleDefinition->GetPDGEncoding();
+   fTrackID = aTrack->GetTrackID();
+   fParentID = aTrack->GetParentID();
+   initialKineticEnergy = aTrack->GetKineticEnergy();
+   initialMomentum = aTrack->GetMomentum();
+   fLastPointTentative = false;
+   // Following is for the first trajectory point
+   fPoints.push_back(G4TrajectoryPoint(aTrack->GetPosition()));
+   fTimes.push_back(aTrack->GetGlobalTime());
+}
+
+G4CompactTrajectory::G4CompactTrajectory(G4CompactTrajectory & right)
+  : G4VTrajectory(), fPoints(right.fPoints), fTimes(right.fTimes)
+{
+  ParticleName = right.ParticleName;
+  PDGCharge = right.PDGCharge;
+  PDGEncoding = right.PDGEncoding;
+  fTrackID = right.fTrackID;
+  fParentID = right.fParentID;
+  initialKineticEnergy = right.initialKineticEnergy;
+  initialMomentum = right.initialMomentum;
+  fLastPointTentative = right.fLastPointTentative;
+}
+
+G4CompactTrajectory::~G4CompactTrajectory()
+{
+}
+
+void G4CompactTrajectory::SetDecimationLength(G4double value)
+{
+  fDecimationLength = (value > 0.) ? value : 0.;
+}
+
+G4double G4CompactTrajectory::GetDecimationLength()
+{
+  return fDecimationLength;
+}
+
+void G4CompactTrajectory::ShowTrajectory(std::ostream& os) const
+{
+  // Invoke the default implementation in G4VTrajectory...
+  G4VTrajectory::ShowTrajectory(os);
+  // ... or override with your own code here.
+}
+
+void G4CompactTrajectory::DrawTrajectory() const
+{
+  // Invoke the default implementation in G4VTrajectory...
+  G4VTrajectory::DrawTrajectory();
+  // ... or override with your own code here.
+}
+
+const std::map<G4String,G4AttDef>* G4CompactTrajectory::GetAttDefs() const
+{
+  G4bool isNew;
+  std::map<G4String,G4AttDef>* store
+    = G4AttDefStore::GetInstance("G4CompactTrajectory",isNew);
+  if (isNew) {
+
+    G4String ID("ID");
+    (*store)[ID] = G4AttDef(ID,"Track ID","Physics","","G4int");
+
+    G4String PID("PID");
+    (*store)[PID] = G4AttDef(PID,"Parent ID","Physics","","G4int");
+
+    G4String PN("PN");
+    (*store)[PN] = G4AttDef(PN,"Particle Name","Physics","","G4String");
+
+    G4String Ch("Ch");
+    (*store)[Ch] = G4AttDef(Ch,"Charge","Physics","e+","G4double");
+
+    G4String PDG("PDG");
+    (*store)[PDG] = G4AttDef(PDG,"PDG Encoding","Physics","","G4int");
+
+    G4String IKE("IKE");
+    (*store)[IKE] = 
+      G4AttDef(IKE, "Initial kinetic energy",
+	       "Physics","G4BestUnit","G4double");
+
+    G4String IMom("IMom");
+    (*store)[IMom] = G4AttDef(IMom, "Initial momentum",
+			      "Physics","G4BestUnit","G4ThreeVector");
+
+    G4String IMag("IMag");
+    (*store)[IMag] = 
+      G4AttDef(IMag, "Initial momentum magnitude",
+	       "Physics","G4BestUnit","G4double");
+
+    G4String NTP("NTP");
+    (*store)[NTP] = G4AttDef(NTP,"No. of points","Physics","","G4int");
+
+  }
+  return store;
+}
+
+std::vector<G4AttValue>* G4CompactTrajectory::CreateAttValues() const
+{
+  std::vector<G4AttValue>* values = new std::vector<G4AttValue>;
+
+  values->push_back
+    (G4AttValue("ID",G4UIcommand::ConvertToString(fTrackID),""));
+
+  values->push_back
+    (G4AttValue("PID",G4UIcommand::ConvertToString(fParentID),""));
+
+  values->push_back(G4AttValue("PN",ParticleName,""));
+
+  values->push_back
+    (G4AttValue("Ch",G4UIcommand::ConvertToString(PDGCharge),""));
+
+  values->push_back
+    (G4AttValue("PDG",G4UIcommand::ConvertToString(PDGEncoding),""));
+
+  values->push_back
+    (G4AttValue("IKE",G4BestUnit(initialKineticEnergy,"Energy"),""));
+
+  values->push_back
+    (G4AttValue("IMom",G4BestUnit(initialMomentum,"Energy"),""));
+
+  values->push_back
+    (G4AttValue("IMag",G4BestUnit(initialMomentum.mag(),"Energy"),""));
+
+  values->push_back
+    (G4AttValue("NTP",G4UIcommand::ConvertToString(GetPointEntries()),""));
+
+#ifdef G4ATTDEBUG
+  G4cout << G4AttCheck(values,GetAttDefs());
+#endif
+
+  return values;
+}
+
+void G4CompactTrajectory::AppendStep(const G4Step* aStep)
+{
+   const G4StepPoint* post = aStep->GetPostStepPoint();
+   const G4ThreeVector& pos = post->GetPosition();
+   if(fDecimationLength > 0.)
+   {
+     // the last point is kept if the track reverses its direction there,
+     // otherwise a tentative last point is replaced by the new one
+     if(fLastPointTentative)
+     {
+       size_t n = fPoints.size();
+       const G4ThreeVector& last = fPoints[n-1].GetPosition();
+       G4ThreeVector dir = last - fPoints[n-2].GetPosition();
+       if(dir.dot(pos - last) >= 0.)
+       {
+         fPoints.pop_back();
+         fTimes.pop_back();
+       }
+     }
+     // the new point is kept if it is far enough from the last kept one
+     fLastPointTentative = ((pos - fPoints.back().GetPosition()).mag2()
+                            < fDecimationLength*fDecimationLength);
+   }
+   fPoints.push_back(G4TrajectoryPoint(pos));
+   fTimes.push_back(post->GetGlobalTime());
+}
+  
+G4ParticleDefinition* G4CompactTrajectory::GetParticleDefinition()
+{
+   return (G4ParticleTable::GetParticleTable()->FindParticle(ParticleName));
+}
+
+void G4CompactTrajectory::MergeTrajectory(G4VTrajectory* secondTrajectory)
+{
+  if(!secondTrajectory) return;
+
+  G4CompactTrajectory* seco = (G4CompactTrajectory*)secondTrajectory;
+  // initial point of the second trajectory should not be merged
+  if(seco->fPoints.size() > 1)
+  {
+    fPoints.insert(fPoints.end(), seco->fPoints.begin()+1, seco->fPoints.end());
+    fTimes.insert(fTimes.end(), seco->fTimes.begin()+1, seco->fTimes.end());
+    // the end of this trajectory is now an intermediate point, kept
+    fLastPointTentative = seco->fLastPointTentative;
+  }
+  seco->fPoints.clear();
+  seco->fTimes.clear();
+}
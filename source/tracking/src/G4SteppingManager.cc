@@ -55,7 +55,11 @@
 //////////////////////////////////////
 G4SteppingManager::G4SteppingManager()
 //////////////////////////////////////
-  : fUserSteppingAction(0), verboseLevel(0)
+  : fUserSteppingAction(0), verboseLevel(0),
+    fFlatProcessList(false), fUseFlatProcessList(false),
+    fFusedPostStepIndex(SizeOfSelectedDoItVector), fFusedCouple(0),
+    fFusedKinEnergy(0.0), fFusedNumberOfInteractionLengthLeft(-1.0),
+    fFusedInteractionLength(DBL_MAX)
 {
 
 // Construct simple 'has-a' related objects
@@ -91,6 +95,16 @@ G4SteppingManager::G4SteppingManager()
 
    physIntLength = DBL_MAX; 
    kCarTolerance = 0.5*G4GeometryTolerance::GetInstance()->GetSurfaceTolerance();
+
+// Particles for which flat process lists are used when enabled
+   fFlatProcessListPDG.push_back(11);
+   fFlatProcessListPDG.push_back(-11);
+   fFlatProcessListPDG.push_back(22);
+   fActivePostStepGPIL.reserve(SizeOfSelectedDoItVector);
+   fActiveAlongStepGPIL.reserve(SizeOfSelectedDoItVector);
+   fActiveAlongStepDoIt.reserve(SizeOfSelectedDoItVector);
+   fFusedProcesses.reserve(SizeOfSelectedDoItVector);
+   fFusedLambda.reserve(SizeOfSelectedDoItVector);
 }
 
 ///////////////////////////////////////
@@ -131,6 +145,10 @@ G4StepStatus G4SteppingManager::Stepping()
  		 G4VSteppingVerbose::SetSilent(0);
 #endif 
 
+// Step profile (/tracking/profile), independent of the verbose level
+   G4bool profiling = (G4SteppingVerbose::GetProfiling() > 0);
+   if( profiling ) G4SteppingVerbose::ProfileStepBegin(fNavigator);
+
 // Store last PostStepPoint to PreStepPoint, and swap current and nex
 // volume information of G4Track. Reset total energy deposit in one Step. 
    fStep->CopyPostToPreStepPoint();
@@ -227,6 +245,7 @@ G4StepStatus G4SteppingManager::Stepping()
 
            if(verboseLevel>0) fVerbose->StepInfo();
 #endif
+   if( profiling ) G4SteppingVerbose::ProfileStepEnd(fStep, fNavigator);
 // Send G4Step information to Hit/Dig if the volume is sensitive
    fCurrentVolume = fStep->GetPreStepPoint()->GetPhysicalVolume();
    StepControlFlag =  fStep->GetControlFlag();
@@ -50,8 +50,13 @@
 #include "G4TransportationManager.hh"
 #include "G4SteppingManager.hh"
 #include "G4LossTableManager.hh"
+#include "G4VEmProcess.hh"
+#include "G4VEmModel.hh"
+#include "G4Log.hh"
 #include "G4ParticleTable.hh"
 
+#include <algorithm>
+
 /////////////////////////////////////////////////
 void G4SteppingManager::GetProcessNumber()
 /////////////////////////////////////////////////
@@ -114,6 +119,17 @@ void G4SteppingManager::GetProcessNumber()
                  "Tracking0012", FatalException,
                  "The array size is smaller than the actual No of processes.");
    }
+
+   BuildFlatProcessList();
+}
+
+/////////////////////////////////////////////////////////////////
+void G4SteppingManager::AddFlatProcessListParticle(G4int pdgCode)
+/////////////////////////////////////////////////////////////////
+{
+  if(std::find(fFlatProcessListPDG.begin(), fFlatProcessListPDG.end(),
+               pdgCode) == fFlatProcessListPDG.end())
+  { fFlatProcessListPDG.push_back(pdgCode); }
 }
 
 
@@ -123,6 +139,129 @@ void G4SteppingManager::GetProcessNumber()
 //
 // ************************************************************************
 
+///////////////////////////////////////////////////
+void G4SteppingManager::BuildFlatProcessList()
+///////////////////////////////////////////////////
+{
+  fUseFlatProcessList = false;
+  fFusedPostStepIndex = SizeOfSelectedDoItVector;
+  if(!fFlatProcessList) return;
+
+  G4int pdg = fTrack->GetDefinition()->GetPDGEncoding();
+  if(std::find(fFlatProcessListPDG.begin(), fFlatProcessListPDG.end(),
+               pdg) == fFlatProcessListPDG.end()) return;
+
+  // Discrete EM processes allowing it share one step limit, which is
+  // computed at the position of the first of them
+  fFusedProcesses.clear();
+  size_t firstFused = SizeOfSelectedDoItVector;
+  for(size_t np=0; np < MAXofPostStepLoops; np++){
+    G4VEmProcess* proc =
+      dynamic_cast<G4VEmProcess*>((*fPostStepGetPhysIntVector)(np));
+    if(proc && proc->AllowFusedStepLimit()) {
+      if(fFusedProcesses.empty()) firstFused = np;
+      fFusedProcesses.push_back(proc);
+    }
+  }
+  // a single process keeps its own step limit
+  if(fFusedProcesses.size() < 2) fFusedProcesses.clear();
+  fFusedLambda.assign(fFusedProcesses.size(), 0.0);
+  fFusedCouple = 0;
+  fFusedNumberOfInteractionLengthLeft = -1.0;
+  fFusedInteractionLength = DBL_MAX;
+
+  fActivePostStepGPIL.clear();
+  for(size_t np=0; np < MAXofPostStepLoops; np++){
+    G4VProcess* proc = (*fPostStepGetPhysIntVector)(np);
+    if(proc && (fFusedProcesses.empty() || np == firstFused ||
+                std::find(fFusedProcesses.begin(), fFusedProcesses.end(),
+                          proc) == fFusedProcesses.end())) {
+      fActivePostStepGPIL.push_back(np);
+    } else {
+      // Inactive or fused for the whole track: never revisited by the 
+      // flat loop
+      (*fSelectedPostStepDoItVector)[np] = InActivated;
+    }
+  }
+  if(!fFusedProcesses.empty()) fFusedPostStepIndex = firstFused;
+
+  fActiveAlongStepGPIL.clear();
+  for(size_t kp=0; kp < MAXofAlongStepLoops; kp++){
+    if((*fAlongStepGetPhysIntVector)[kp]) fActiveAlongStepGPIL.push_back(kp);
+  }
+
+  fActiveAlongStepDoIt.clear();
+  for(size_t ci=0; ci < MAXofAlongStepLoops; ci++){
+    if((*fAlongStepDoItVector)[ci]) fActiveAlongStepDoIt.push_back(ci);
+  }
+
+  fUseFlatProcessList = true;
+}
+
+
+///////////////////////////////////////////////////
+G4double G4SteppingManager::FusedPostStepGPIL()
+///////////////////////////////////////////////////
+{
+  // Same bookkeeping as G4VEmProcess::PostStepGetPhysicalInteractionLength
+  // with the sum of the cross sections of the fused processes. The sum 
+  // is recomputed only if the energy or the couple changed.
+  G4double energy = fTrack->GetKineticEnergy();
+  const G4MaterialCutsCouple* couple = fTrack->GetMaterialCutsCouple();
+  if(energy != fFusedKinEnergy || couple != fFusedCouple) {
+    fFusedKinEnergy = energy;
+    fFusedCouple = couple;
+    size_t idx = couple->GetIndex();
+    G4double sum = 0.0;
+    for(size_t i=0; i<fFusedProcesses.size(); i++){
+      G4VEmProcess* proc = fFusedProcesses[i];
+      G4double e = energy;
+      G4double lambda = proc->GetLambda(e, couple);
+      if(lambda > 0.0 &&
+         proc->SelectModelForMaterial(energy, idx)->IsActive(energy))
+      { sum += lambda; }
+      fFusedLambda[i] = sum;
+    }
+  }
+
+  G4double sum = fFusedLambda.back();
+  if(sum <= 0.0) {
+    fFusedNumberOfInteractionLengthLeft = -1.0;
+    fFusedInteractionLength = DBL_MAX;
+    return DBL_MAX;
+  }
+  if(fFusedNumberOfInteractionLengthLeft < 0.0) {
+    fFusedNumberOfInteractionLengthLeft = -G4Log( G4UniformRand() );
+  } else if(fFusedInteractionLength < DBL_MAX) {
+    fFusedNumberOfInteractionLengthLeft -= 
+      fPreviousStepSize/fFusedInteractionLength;
+    fFusedNumberOfInteractionLengthLeft = 
+      std::max(fFusedNumberOfInteractionLengthLeft, 0.0);
+  }
+  fFusedInteractionLength = 1.0/sum;
+  return fFusedNumberOfInteractionLengthLeft*fFusedInteractionLength;
+}
+
+///////////////////////////////////////////////////
+G4VProcess* G4SteppingManager::SelectFusedProcess()
+///////////////////////////////////////////////////
+{
+  // Cross sections are those of the pre-step point, as in the 
+  // step limit of each process
+  size_t n = fFusedProcesses.size() - 1;
+  G4double x = fFusedLambda[n]*G4UniformRand();
+  size_t i = 0;
+  for(; i<n; i++){
+    if(x < fFusedLambda[i]) break;
+  }
+  fFusedNumberOfInteractionLengthLeft = -1.0;
+
+  // Define the material of the selected process for its PostStepDoIt
+  G4double e = fFusedKinEnergy;
+  fFusedProcesses[i]->GetLambda(e, fFusedCouple);
+  return fFusedProcesses[i];
+}
+
 
 /////////////////////////////////////////////////////////
  void G4SteppingManager::DefinePhysicalStepLength()
@@ -162,17 +301,25 @@ void G4SteppingManager::GetProcessNumber()
 // GPIL for PostStep
    fPostStepDoItProcTriggered = MAXofPostStepLoops;
 
-   for(size_t np=0; np < MAXofPostStepLoops; np++){
+   size_t nPostStep = fUseFlatProcessList ? fActivePostStepGPIL.size()
+                                          : MAXofPostStepLoops;
+   for(size_t ip=0; ip < nPostStep; ip++){
+     size_t np = fUseFlatProcessList ? fActivePostStepGPIL[ip] : ip;
      fCurrentProcess = (*fPostStepGetPhysIntVector)(np);
      if (fCurrentProcess== 0) {
        (*fSelectedPostStepDoItVector)[np] = InActivated;
        continue;
      }   // NULL means the process is inactivated by a user on fly.
 
-     physIntLength = fCurrentProcess->
-                     PostStepGPIL( *fTrack,
-                                                 fPreviousStepSize,
-                                                      &fCondition );
+     if (np == fFusedPostStepIndex) {
+       physIntLength = FusedPostStepGPIL();
+       fCondition = NotForced;
+     } else {
+       physIntLength = fCurrentProcess->
+                       PostStepGPIL( *fTrack,
+                                                   fPreviousStepSize,
+                                                        &fCondition );
+     }
 #ifdef G4VERBOSE
                          // !!!!! Verbose
      if(verboseLevel>0) fVerbose->DPSLPostStep();
@@ -234,7 +381,10 @@ void G4SteppingManager::GetProcessNumber()
    proposedSafety = DBL_MAX;
    G4double safetyProposedToAndByProcess = proposedSafety;
 
-   for(size_t kp=0; kp < MAXofAlongStepLoops; kp++){
+   size_t nAlongStep = fUseFlatProcessList ? fActiveAlongStepGPIL.size()
+                                           : MAXofAlongStepLoops;
+   for(size_t ip=0; ip < nAlongStep; ip++){
+     size_t kp = fUseFlatProcessList ? fActiveAlongStepGPIL[ip] : ip;
      fCurrentProcess = (*fAlongStepGetPhysIntVector)[kp];
      if (fCurrentProcess== 0) continue;
          // NULL means the process is inactivated by a user on fly.
@@ -408,7 +558,10 @@ void G4SteppingManager::InvokeAlongStepDoItProcs()
    }
 
 // Invoke the all active continuous processes
-   for( size_t ci=0 ; ci<MAXofAlongStepLoops ; ci++ ){
+   size_t nAlongStep = fUseFlatProcessList ? fActiveAlongStepDoIt.size()
+                                           : MAXofAlongStepLoops;
+   for( size_t ic=0 ; ic<nAlongStep ; ic++ ){
+     size_t ci = fUseFlatProcessList ? fActiveAlongStepDoIt[ic] : ic;
      fCurrentProcess = (*fAlongStepDoItVector)[ci];
      if (fCurrentProcess== 0) continue;
          // NULL means the process is inactivated by a user on fly.
@@ -525,7 +678,13 @@ void G4SteppingManager::InvokePostStepDoItProcs()
 
 void G4SteppingManager::InvokePSDIP(size_t np)
 {
-         fCurrentProcess = (*fPostStepDoItVector)[np];
+         if (MAXofPostStepLoops-np-1 == fFusedPostStepIndex) {
+           fCurrentProcess = SelectFusedProcess();
+           fStep->GetPostStepPoint()
+                ->SetProcessDefinedStep(fCurrentProcess);
+         } else {
+           fCurrentProcess = (*fPostStepDoItVector)[np];
+         }
          fParticleChange 
             = fCurrentProcess->PostStepDoIt( *fTrack, *fStep);
 
@@ -44,6 +44,16 @@
 #include "G4SystemOfUnits.hh"
 #include "G4VSensitiveDetector.hh"    // Include from 'hits/digi'
 #include "G4StepStatus.hh"    // Include from 'tracking'
+#include "G4LogicalVolume.hh"
+#include "G4Region.hh"
+#include "G4Navigator.hh"
+#include "G4AutoLock.hh"
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <fstream>
+#include <chrono>
+#include <tuple>
 
 ///#define G4_USE_G4BESTUNIT_FOR_VERBOSE 1
 
@@ -53,6 +63,124 @@
 #define G4BestUnit(a,b) a
 #endif
 
+namespace
+{
+  // Profile counters, per thread with pointer keys and merged with names
+  struct G4StepProfileData
+  {
+    G4StepProfileData()
+      : nSteps(0), nGeomLimited(0), nComputeStep(0), nLocate(0),
+        nSampled(0), time(0.) {}
+    void Add(const G4StepProfileData& right)
+    {
+      nSteps += right.nSteps;
+      nGeomLimited += right.nGeomLimited;
+      nComputeStep += right.nComputeStep;
+      nLocate += right.nLocate;
+      nSampled += right.nSampled;
+      time += right.time;
+    }
+    G4double EstimatedTime() const
+    { return (nSampled>0) ? time*G4double(nSteps)/G4double(nSampled) : 0.; }
+    G4long nSteps;
+    G4long nGeomLimited;
+    G4long nComputeStep;   // navigator calls
+    G4long nLocate;
+    G4long nSampled;
+    G4double time;   // in seconds
+  };
+
+  struct G4StepProfileKey
+  {
+    const G4ParticleDefinition* particle;
+    const G4VProcess* process;
+    const G4Region* region;
+    const G4LogicalVolume* volume;
+    G4bool operator<(const G4StepProfileKey& right) const
+    {
+      return std::tie(particle,process,region,volume)
+           < std::tie(right.particle,right.process,right.region,right.volume);
+    }
+    G4bool operator==(const G4StepProfileKey& right) const
+    {
+      return particle==right.particle && process==right.process
+          && region==right.region && volume==right.volume;
+    }
+  };
+
+  struct G4StepProfileName
+  {
+    G4String particle, process, region, volume;
+    G4bool operator<(const G4StepProfileName& right) const
+    {
+      return std::tie(particle,process,region,volume)
+           < std::tie(right.particle,right.process,right.region,right.volume);
+    }
+  };
+
+  typedef std::map<G4StepProfileKey,G4StepProfileData> G4StepProfileMap;
+  typedef std::map<G4StepProfileName,G4StepProfileData> G4StepProfileNameMap;
+  typedef std::chrono::steady_clock G4StepProfileClock;
+
+  G4ThreadLocal G4StepProfileMap* stepProfile = 0;
+  G4ThreadLocal G4StepProfileData* lastStepProfile = 0;
+  G4ThreadLocal G4StepProfileKey* lastStepProfileKey = 0;
+  G4ThreadLocal G4long stepProfileCounter = 0;
+  G4ThreadLocal G4bool stepProfileTimed = false;
+  G4ThreadLocal G4StepProfileClock::time_point* stepProfileStart = 0;
+  G4ThreadLocal G4long stepProfileComputeStep = 0;
+  G4ThreadLocal G4long stepProfileLocate = 0;
+
+  G4StepProfileNameMap* mergedStepProfile = 0;
+  G4Mutex stepProfileMutex = G4MUTEX_INITIALIZER;
+
+  // Names are written between quotes in the JSON output
+  std::string JsonString(const G4String& name)
+  {
+    std::ostringstream os;
+    os << '"';
+    for(size_t i=0; i<name.size(); ++i)
+    {
+      char c = name[i];
+      switch(c)
+      {
+        case '"':  os << "\\\""; break;
+        case '\\': os << "\\\\"; break;
+        case '\b': os << "\\b"; break;
+        case '\f': os << "\\f"; break;
+        case '\n': os << "\\n"; break;
+        case '\r': os << "\\r"; break;
+        case '\t': os << "\\t"; break;
+        default:
+          if(static_cast<unsigned char>(c) < 0x20)
+          {
+            os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+               << G4int(c) << std::dec << std::setfill(' ');
+          }
+          else { os << c; }
+      }
+    }
+    os << '"';
+    return os.str();
+  }
+
+  // and quoted in the CSV output if they contain a separator or a quote
+  std::string CsvString(const G4String& name)
+  {
+    if(name.find_first_of(",\"\n\r") == std::string::npos) { return name; }
+    std::string s("\"");
+    for(size_t i=0; i<name.size(); ++i)
+    {
+      if(name[i]=='"') { s += '"'; }
+      s += name[i];
+    }
+    return s + '"';
+  }
+}
+
+G4ThreadLocal G4int G4SteppingVerbose::fProfileSampling = 0;
+G4ThreadLocal G4String* G4SteppingVerbose::fProfileFileName = 0;
+
 //////////////////////////////////////////////////
 G4SteppingVerbose::G4SteppingVerbose()
 //////////////////////////////////////////////////
@@ -874,3 +1002,244 @@ void G4SteppingVerbose::ShowStep() const
 }
 
 
+
+////////////////////////////////////////
+void G4SteppingVerbose::ProfileStepBegin(const G4Navigator* navigator)
+////////////////////////////////////////
+{
+  if(navigator)
+  {
+    stepProfileComputeStep = navigator->GetNumberOfComputeStepCalls();
+    stepProfileLocate = navigator->GetNumberOfLocateCalls();
+  }
+  if(++stepProfileCounter%fProfileSampling==0)
+  {
+    if(!stepProfileStart)
+    { stepProfileStart = new G4StepProfileClock::time_point; }
+    *stepProfileStart = G4StepProfileClock::now();
+    stepProfileTimed = true;
+  }
+}
+
+////////////////////////////////////////
+void G4SteppingVerbose::ProfileStepEnd(const G4Step* aStep,
+                                       const G4Navigator* navigator)
+////////////////////////////////////////
+{
+  // Time of the GPIL and DoIt part of the step, for sampled steps only
+  G4double dt = -1.;
+  if(stepProfileTimed)
+  {
+    dt = std::chrono::duration<G4double>(G4StepProfileClock::now()
+                                         - *stepProfileStart).count();
+    stepProfileTimed = false;
+  }
+
+  const G4StepPoint* postStep = aStep->GetPostStepPoint();
+  const G4VPhysicalVolume* pv = aStep->GetPreStepPoint()->GetPhysicalVolume();
+  G4StepProfileKey key;
+  key.particle = aStep->GetTrack()->GetDefinition();
+  key.process = postStep->GetProcessDefinedStep();
+  key.volume = pv ? pv->GetLogicalVolume() : 0;
+  key.region = key.volume ? key.volume->GetRegion() : 0;
+
+  // Consecutive steps share most often the same key
+  if(!lastStepProfileKey || !(key==*lastStepProfileKey))
+  {
+    if(!stepProfile) { stepProfile = new G4StepProfileMap; }
+    if(!lastStepProfileKey) { lastStepProfileKey = new G4StepProfileKey; }
+    *lastStepProfileKey = key;
+    lastStepProfile = &((*stepProfile)[key]);
+  }
+  lastStepProfile->nSteps++;
+  if(postStep->GetStepStatus()==fGeomBoundary) lastStepProfile->nGeomLimited++;
+  if(navigator)
+  {
+    lastStepProfile->nComputeStep +=
+      navigator->GetNumberOfComputeStepCalls() - stepProfileComputeStep;
+    lastStepProfile->nLocate +=
+      navigator->GetNumberOfLocateCalls() - stepProfileLocate;
+  }
+  if(dt>=0.)
+  {
+    lastStepProfile->nSampled++;
+    lastStepProfile->time += dt;
+  }
+}
+
+////////////////////////////////////////
+void G4SteppingVerbose::SetProfiling(G4int samplingPeriod)
+////////////////////////////////////////
+{
+  fProfileSampling = std::max(samplingPeriod,0);
+  stepProfileCounter = 0;
+  stepProfileTimed = false;
+}
+
+////////////////////////////////////////
+G4int G4SteppingVerbose::GetProfiling()
+////////////////////////////////////////
+{
+  return fProfileSampling;
+}
+
+////////////////////////////////////////
+void G4SteppingVerbose::SetProfileFileName(const G4String& fileName)
+////////////////////////////////////////
+{
+  if(!fProfileFileName) { fProfileFileName = new G4String; }
+  *fProfileFileName = fileName;
+}
+
+////////////////////////////////////////
+const G4String& G4SteppingVerbose::GetProfileFileName()
+////////////////////////////////////////
+{
+  if(!fProfileFileName) { fProfileFileName = new G4String; }
+  return *fProfileFileName;
+}
+
+////////////////////////////////////////
+void G4SteppingVerbose::MergeProfile()
+////////////////////////////////////////
+{
+  if(!stepProfile) { return; }
+  G4AutoLock l(&stepProfileMutex);
+  if(!mergedStepProfile) { mergedStepProfile = new G4StepProfileNameMap; }
+  for(G4StepProfileMap::const_iterator itr = stepProfile->begin();
+      itr != stepProfile->end(); ++itr)
+  {
+    const G4StepProfileKey& key = itr->first;
+    G4StepProfileName name;
+    name.particle = key.particle ? key.particle->GetParticleName() : "none";
+    name.process = key.process ? key.process->GetProcessName() : "none";
+    name.region = key.region ? key.region->GetName() : "none";
+    name.volume = key.volume ? key.volume->GetName() : "OutOfWorld";
+    (*mergedStepProfile)[name].Add(itr->second);
+  }
+  l.unlock();
+
+  stepProfile->clear();
+  lastStepProfile = 0;
+  delete lastStepProfileKey;
+  lastStepProfileKey = 0;
+}
+
+////////////////////////////////////////
+void G4SteppingVerbose::WriteProfile()
+////////////////////////////////////////
+{
+  G4AutoLock l(&stepProfileMutex);
+  if(!mergedStepProfile || mergedStepProfile->empty()) { return; }
+
+  // Entries sorted by decreasing estimated time, then number of steps
+  typedef std::pair<const G4StepProfileName*,const G4StepProfileData*> Entry;
+  std::vector<Entry> entries;
+  G4long nStepsTot = 0;
+  G4double timeTot = 0.;
+  for(G4StepProfileNameMap::const_iterator itr = mergedStepProfile->begin();
+      itr != mergedStepProfile->end(); ++itr)
+  {
+    entries.push_back(Entry(&(itr->first),&(itr->second)));
+    nStepsTot += itr->second.nSteps;
+    timeTot += itr->second.EstimatedTime();
+  }
+  std::sort(entries.begin(),entries.end(),
+            [](const Entry& a, const Entry& b)
+            {
+              G4double ta = a.second->EstimatedTime();
+              G4double tb = b.second->EstimatedTime();
+              if(ta!=tb) return ta>tb;
+              return a.second->nSteps>b.second->nSteps;
+            });
+
+  const G4String& fileName = GetProfileFileName();
+  if(fileName.empty())
+  {
+    size_t nPrint = std::min(entries.size(),size_t(20));
+    G4int prec = G4cout.precision(4);
+    G4cout << G4endl
+           << "=== G4SteppingVerbose profile: " << nStepsTot << " steps, "
+           << timeTot << " s estimated (main entries)" << G4endl
+           << std::setw(12) << "Particle" << std::setw(20) << "Process"
+           << std::setw(20) << "Region" << std::setw(20) << "Volume"
+           << std::setw(12) << "Steps" << std::setw(12) << "GeomLimited"
+           << std::setw(12) << "ComputeStep" << std::setw(12) << "Locate"
+           << std::setw(12) << "Time[s]" << G4endl;
+    for(size_t i=0; i<nPrint; ++i)
+    {
+      const G4StepProfileName& name = *(entries[i].first);
+      const G4StepProfileData& data = *(entries[i].second);
+      G4cout << std::setw(12) << name.particle << std::setw(20) << name.process
+             << std::setw(20) << name.region << std::setw(20) << name.volume
+             << std::setw(12) << data.nSteps << std::setw(12) << data.nGeomLimited
+             << std::setw(12) << data.nComputeStep << std::setw(12) << data.nLocate
+             << std::setw(12) << data.EstimatedTime() << G4endl;
+    }
+    G4cout.precision(prec);
+    return;
+  }
+
+  std::ofstream out(fileName);
+  if(!out)
+  {
+    G4ExceptionDescription ed;
+    ed << "Cannot open the profile output file " << fileName;
+    G4Exception("G4SteppingVerbose::WriteProfile()", "Tracking0016",
+                JustWarning, ed);
+    return;
+  }
+
+  G4bool json = (fileName.size()>5
+                 && fileName.substr(fileName.size()-5)==".json");
+  if(json)
+  {
+    out << "{" << std::endl
+        << "  \"totalSteps\": " << nStepsTot << "," << std::endl
+        << "  \"estimatedTime\": " << timeTot << "," << std::endl
+        << "  \"entries\": [" << std::endl;
+  }
+  else
+  {
+    out << "particle,process,region,volume,steps,geomLimitedSteps,"
+        << "computeStepCalls,locateCalls,"
+        << "sampledSteps,sampledTime[s],estimatedTime[s]" << std::endl;
+  }
+  for(size_t i=0; i<entries.size(); ++i)
+  {
+    const G4StepProfileName& name = *(entries[i].first);
+    const G4StepProfileData& data = *(entries[i].second);
+    if(json)
+    {
+      out << "    {\"particle\": " << JsonString(name.particle)
+          << ", \"process\": " << JsonString(name.process)
+          << ", \"region\": " << JsonString(name.region)
+          << ", \"volume\": " << JsonString(name.volume)
+          << ", \"steps\": " << data.nSteps
+          << ", \"geomLimitedSteps\": " << data.nGeomLimited
+          << ", \"computeStepCalls\": " << data.nComputeStep
+          << ", \"locateCalls\": " << data.nLocate
+          << ", \"sampledSteps\": " << data.nSampled
+          << ", \"sampledTime\": " << data.time
+          << ", \"estimatedTime\": " << data.EstimatedTime() << "}"
+          << ((i+1<entries.size()) ? "," : "") << std::endl;
+    }
+    else
+    {
+      out << CsvString(name.particle) << "," << CsvString(name.process) << ","
+          << CsvString(name.region) << "," << CsvString(name.volume) << ","
+          << data.nSteps << "," << data.nGeomLimited << ","
+          << data.nComputeStep << "," << data.nLocate << "," << data.nSampled << "," << data.time << "," << data.EstimatedTime()
+          << std::endl;
+    }
+  }
+  if(json) { out << "  ]" << std::endl << "}" << std::endl; }
+}
+
+////////////////////////////////////////
+void G4SteppingVerbose::ResetProfile()
+////////////////////////////////////////
+{
+  G4AutoLock l(&stepProfileMutex);
+  if(mergedStepProfile) { mergedStepProfile->clear(); }
+}
@@ -46,6 +46,9 @@
 #include "G4UIdirectory.hh"
 #include "G4UIcmdWithoutParameter.hh"
 #include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UIcmdWithAString.hh"
 #include "G4UImanager.hh"
 #include "globals.hh"
 #include "G4TrackingManager.hh"
@@ -55,6 +58,8 @@
 #include "G4TransportationManager.hh"
 #include "G4PropagatorInField.hh"
 #include "G4IdentityTrajectoryFilter.hh"
+#include "G4CompactTrajectory.hh"
+#include "G4SteppingVerbose.hh"
 
 ///////////////////////////////////////////////////////////////////
 G4TrackingMessenger::G4TrackingMessenger(G4TrackingManager * trMan)
@@ -81,9 +86,20 @@ G4TrackingMessenger::G4TrackingMessenger(G4TrackingManager * trMan)
   StoreTrajectoryCmd->SetGuidance(" 2 : Choose G4SmoothTrajectory as default.");
   StoreTrajectoryCmd->SetGuidance(" 3 : Choose G4RichTrajectory as default.");
   StoreTrajectoryCmd->SetGuidance(" 4 : Choose G4RichTrajectory with auxiliary points as default.");
+  StoreTrajectoryCmd->SetGuidance(" 5 : Choose G4CompactTrajectory as default.");
   StoreTrajectoryCmd->SetParameterName("Store",true);
   StoreTrajectoryCmd->SetDefaultValue(0);
-  StoreTrajectoryCmd->SetRange("Store >=0 && Store <= 4"); 
+  StoreTrajectoryCmd->SetRange("Store >=0 && Store <= 5"); 
+
+  TrajectoryDecimationCmd = new G4UIcmdWithADoubleAndUnit("/tracking/trajectoryDecimation",this);
+  TrajectoryDecimationCmd->SetGuidance("Minimum distance between kept points of G4CompactTrajectory.");
+  TrajectoryDecimationCmd->SetGuidance(" Points closer to the last kept point are dropped while the");
+  TrajectoryDecimationCmd->SetGuidance(" trajectory is recorded, except where the direction reverses.");
+  TrajectoryDecimationCmd->SetGuidance(" The last point of the track is always stored.");
+  TrajectoryDecimationCmd->SetGuidance(" 0 (default) stores every step.");
+  TrajectoryDecimationCmd->SetParameterName("length",false);
+  TrajectoryDecimationCmd->SetRange("length >= 0.");
+  TrajectoryDecimationCmd->SetDefaultUnit("mm");
 
 
   VerboseCmd = new G4UIcmdWithAnInteger("/tracking/verbose",this);
@@ -105,6 +121,35 @@ G4TrackingMessenger::G4TrackingMessenger(G4TrackingManager * trMan)
 #else 
   VerboseCmd->SetGuidance("You need to recompile the tracking category defining G4VERBOSE ");  
 #endif
+
+  FlatProcessListCmd = new G4UIcmdWithABool("/tracking/flatProcessList",this);
+  FlatProcessListCmd->SetGuidance("Use flat lists of the active processes for e-, e+ and gamma.");
+  FlatProcessListCmd->SetGuidance(" The lists are built at the start of each track, so processes");
+  FlatProcessListCmd->SetGuidance(" (in)activated during a track are taken into account at the next one.");
+  FlatProcessListCmd->SetGuidance(" Discrete EM processes allowing it share one step limit, the process");
+  FlatProcessListCmd->SetGuidance(" which interacts is selected in proportion to its cross section.");
+  FlatProcessListCmd->SetParameterName("flag",true);
+  FlatProcessListCmd->SetDefaultValue(true);
+
+  ProfileCmd = new G4UIcmdWithAnInteger("/tracking/profile",this);
+  ProfileCmd->SetGuidance("Profile the stepping.");
+  ProfileCmd->SetGuidance(" Steps and navigator calls (ComputeStep, Locate) are counted");
+  ProfileCmd->SetGuidance(" per particle, process, region and volume, and the time of one");
+  ProfileCmd->SetGuidance(" step in N is measured. The per-thread tables are merged and");
+  ProfileCmd->SetGuidance(" written at the end of each run.");
+  ProfileCmd->SetGuidance(" 0 : Off (default).");
+  ProfileCmd->SetGuidance(" N>0 : Sampling period of the step timing.");
+  ProfileCmd->SetGuidance(" Independent of /tracking/verbose and of the stepping verbose.");
+  ProfileCmd->SetParameterName("N",true);
+  ProfileCmd->SetDefaultValue(0);
+  ProfileCmd->SetRange("N >=0");
+
+  ProfileFileCmd = new G4UIcmdWithAString("/tracking/profileFile",this);
+  ProfileFileCmd->SetGuidance("Output file of /tracking/profile.");
+  ProfileFileCmd->SetGuidance(" JSON if the name ends with .json, CSV otherwise.");
+  ProfileFileCmd->SetGuidance(" Without name (default) a summary is printed to G4cout.");
+  ProfileFileCmd->SetParameterName("fileName",true);
+  ProfileFileCmd->SetDefaultValue("");
 }
 
 ////////////////////////////////////////////
@@ -116,6 +161,10 @@ G4TrackingMessenger::~G4TrackingMessenger()
   delete ResumeCmd;
   delete StoreTrajectoryCmd;
   delete VerboseCmd;
+  delete FlatProcessListCmd;
+  delete TrajectoryDecimationCmd;
+  delete ProfileCmd;
+  delete ProfileFileCmd;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -151,6 +200,22 @@ void G4TrackingMessenger::SetNewValue(G4UIcommand * command,G4String newValues)
     }
     trackingManager->SetStoreTrajectory(trajType);
   }
+
+  if( command == TrajectoryDecimationCmd ){
+    G4CompactTrajectory::SetDecimationLength(TrajectoryDecimationCmd->GetNewDoubleValue(newValues));
+  }
+
+  if( command == FlatProcessListCmd ){
+    steppingManager->SetFlatProcessList(FlatProcessListCmd->GetNewBoolValue(newValues));
+  }
+
+  if( command == ProfileCmd ){
+    G4SteppingVerbose::SetProfiling(ProfileCmd->ConvertToInt(newValues));
+  }
+
+  if( command == ProfileFileCmd ){
+    G4SteppingVerbose::SetProfileFileName(newValues);
+  }
 }
 
 
@@ -164,6 +229,18 @@ G4String G4TrackingMessenger::GetCurrentValue(G4UIcommand * command)
   else if( command == StoreTrajectoryCmd ){
     return StoreTrajectoryCmd->ConvertToString(trackingManager->GetStoreTrajectory());
   }
+  else if( command == TrajectoryDecimationCmd ){
+    return TrajectoryDecimationCmd->ConvertToString(G4CompactTrajectory::GetDecimationLength(),"mm");
+  }
+  else if( command == FlatProcessListCmd ){
+    return FlatProcessListCmd->ConvertToString(steppingManager->GetFlatProcessList());
+  }
+  else if( command == ProfileCmd ){
+    return ProfileCmd->ConvertToString(G4SteppingVerbose::GetProfiling());
+  }
+  else if( command == ProfileFileCmd ){
+    return G4SteppingVerbose::GetProfileFileName();
+  }
   return G4String('\0');
 }
 